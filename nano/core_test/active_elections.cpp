@@ -621,11 +621,8 @@ TEST (active_elections, vote_replays)
 	ASSERT_EQ (nano::vote_code::replay, node.vote_router.vote (vote1_send2).at (send2->hash ()));
 	ASSERT_EQ (nano::vote_code::replay, node.vote_router.vote (vote2_send2).at (send2->hash ()));
 
-	// Removing blocks as recently confirmed makes every vote indeterminate
-	{
-		nano::lock_guard<nano::mutex> guard (node.active.mutex);
-		node.active.recently_confirmed.clear ();
-	}
+	// Removing blocks as recently confirmed makes every vote indeterminate, the election for send2 is already gone so no shard needs to be held
+	node.active.recently_confirmed.clear ();
 	ASSERT_EQ (nano::vote_code::indeterminate, node.vote_router.vote (vote_send1).at (send1->hash ()));
 	ASSERT_EQ (nano::vote_code::indeterminate, node.vote_router.vote (vote_open1).at (open1->hash ()));
 	ASSERT_EQ (nano::vote_code::indeterminate, node.vote_router.vote (vote1_send2).at (send2->hash ()));
@@ -1008,7 +1005,6 @@ TEST (active_elections, confirmation_consistency)
 		ASSERT_NE (nullptr, block);
 		ASSERT_TIMELY (5s, node.block_confirmed (block->hash ()));
 		ASSERT_NO_ERROR (system.poll_until_true (1s, [&node, &block, i] {
-			nano::lock_guard<nano::mutex> guard (node.active.mutex);
 			EXPECT_EQ (i + 1, node.active.recently_confirmed.size ());
 			EXPECT_EQ (block->qualified_root (), node.active.recently_confirmed.back ().first);
 			return i + 1 == node.active.recently_cemented.size (); // done after a callback
@@ -1291,6 +1287,35 @@ TEST (active_elections, list_active)
 	auto active = node.active.list_active ();
 }
 
+// Elections are spread across shards, listing should still return them in insertion order
+TEST (active_elections, list_active_order)
+{
+	nano::test::system system (1);
+	auto & node = *system.nodes[0];
+
+	auto blocks = nano::test::setup_independent_blocks (system, node, 32);
+	ASSERT_TRUE (nano::test::start_elections (system, node, blocks));
+	ASSERT_EQ (blocks.size (), node.active.size ());
+
+	auto active = node.active.list_active ();
+	ASSERT_EQ (blocks.size (), active.size ());
+	for (std::size_t i = 0; i < blocks.size (); ++i)
+	{
+		ASSERT_EQ (blocks[i]->qualified_root (), active[i]->qualified_root);
+	}
+
+	auto first = node.active.list_active (5);
+	ASSERT_EQ (5, first.size ());
+	for (std::size_t i = 0; i < first.size (); ++i)
+	{
+		ASSERT_EQ (blocks[i]->qualified_root (), first[i]->qualified_root);
+	}
+
+	ASSERT_TRUE (node.active.erase (*blocks[0]));
+	ASSERT_EQ (blocks.size () - 1, node.active.size ());
+	ASSERT_EQ (blocks[1]->qualified_root (), node.active.list_active (1).front ()->qualified_root);
+}
+
 TEST (active_elections, vacancy)
 {
 	std::atomic<bool> updated = false;
@@ -0,0 +1,50 @@
+#include <nano/node/adaptive_batch.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST (adaptive_batch, grow)
+{
+	nano::adaptive_batch_config config{ 16, 1024, 50ms };
+	nano::adaptive_batch batch{ config, 64 };
+	ASSERT_EQ (64, batch.next (0));
+	// Full batches far below the target double
+	batch.update (64, 64, 1ms);
+	ASSERT_EQ (128, batch.size ());
+	// Full batches close to the target grow slowly
+	batch.update (128, 128, 40ms);
+	ASSERT_EQ (144, batch.size ());
+	// Batches which were not full do not grow
+	batch.update (144, 10, 1ms);
+	ASSERT_EQ (144, batch.size ());
+	for (int i = 0; i < 16; ++i)
+	{
+		batch.update (batch.size (), batch.size (), 1ms);
+	}
+	ASSERT_EQ (1024, batch.size ());
+}
+
+TEST (adaptive_batch, shrink)
+{
+	nano::adaptive_batch_config config{ 16, 1024, 50ms };
+	nano::adaptive_batch batch{ config, 256 };
+	batch.update (256, 256, 100ms);
+	ASSERT_EQ (128, batch.size ());
+	for (int i = 0; i < 16; ++i)
+	{
+		batch.update (batch.size (), batch.size (), 100ms);
+	}
+	ASSERT_EQ (16, batch.size ());
+}
+
+// Other writers waiting for the write lock get a share of the time
+TEST (adaptive_batch, waiters)
+{
+	nano::adaptive_batch_config config{ 16, 1024, 50ms };
+	nano::adaptive_batch batch{ config, 256 };
+	ASSERT_EQ (256, batch.next (0));
+	ASSERT_EQ (128, batch.next (1));
+	ASSERT_EQ (64, batch.next (3));
+	ASSERT_EQ (16, batch.next (100));
+}
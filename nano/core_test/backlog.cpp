@@ -48,6 +48,36 @@ TEST (backlog, population)
 	ASSERT_TIMELY (5s, all_activated ());
 }
 
+/*
+ * Ensures backlog population switches to the unconfirmed accounts index after one full scan and keeps activating accounts from it
+ */
+TEST (backlog, unconfirmed_index)
+{
+	nano::mutex mutex;
+	std::unordered_set<nano::account> activated;
+
+	nano::test::system system{};
+	auto & node = *system.add_node ();
+
+	node.backlog.activate_callback.add ([&] (nano::secure::transaction const & transaction, nano::account const & account) {
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		activated.insert (account);
+	});
+
+	auto blocks = nano::test::setup_independent_blocks (system, node, 64);
+
+	ASSERT_TIMELY (5s, node.ledger.cache.unconfirmed.complete ());
+	ASSERT_TIMELY (5s, node.stats.count (nano::stat::type::backlog, nano::stat::detail::index_scan) > 0);
+	{
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		activated.clear ();
+	}
+	ASSERT_TIMELY (5s, std::all_of (blocks.begin (), blocks.end (), [&] (auto const & item) {
+		nano::lock_guard<nano::mutex> lock{ mutex };
+		return activated.count (item->account ()) != 0 && node.ledger.cache.unconfirmed.exists (item->account ());
+	}));
+}
+
 /*
  * Ensures that elections are activated without live traffic
  */
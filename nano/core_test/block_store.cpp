@@ -15,6 +15,7 @@
 #include <nano/store/block.hpp>
 #include <nano/store/lmdb/lmdb.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
+#include <nano/store/value_view.hpp>
 #include <nano/store/versioning.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
@@ -327,6 +328,43 @@ TEST (block_store, pending_iterator)
 	ASSERT_EQ (nano::epoch::epoch_1, pending.epoch);
 }
 
+TEST (block_store, value_views)
+{
+	nano::logger logger;
+	auto store = nano::make_store (logger, nano::unique_path (), nano::dev::constants);
+	ASSERT_TRUE (!store->init_error ());
+	auto transaction (store->tx_begin_write ());
+	nano::account_info info{ 1, 2, 3, 4, 5, 6, nano::epoch::epoch_2 };
+	store->account.put (transaction, nano::account (10), info);
+	store->pending.put (transaction, nano::pending_key (1, 2), { 3, 4, nano::epoch::epoch_1 });
+
+	auto account_it (store->account.begin (transaction));
+	ASSERT_NE (store->account.end (), account_it);
+	auto account_view = account_it.value_view<nano::store::account_info_view> ();
+	ASSERT_EQ (info.head, account_view.head ());
+	ASSERT_EQ (info.representative, account_view.representative ());
+	ASSERT_TRUE (account_view.representative_equals (info.representative));
+	ASSERT_FALSE (account_view.representative_equals (nano::account (1)));
+	ASSERT_EQ (info.open_block, account_view.open_block ());
+	ASSERT_EQ (info.balance, account_view.balance ());
+	ASSERT_EQ (info.modified, account_view.modified ());
+	ASSERT_EQ (info.block_count, account_view.block_count ());
+	ASSERT_EQ (info.epoch (), account_view.epoch ());
+	// Views and the deserialized pair can be mixed on the same position
+	ASSERT_EQ (info, account_it->second);
+	ASSERT_EQ (nano::account (10), account_it->first);
+
+	auto pending_it (store->pending.begin (transaction));
+	ASSERT_NE (store->pending.end (), pending_it);
+	auto key_view = pending_it.key_view<nano::store::pending_key_view> ();
+	ASSERT_EQ (nano::account (1), key_view.account ());
+	ASSERT_EQ (nano::block_hash (2), key_view.hash ());
+	auto pending_view = pending_it.value_view<nano::store::pending_info_view> ();
+	ASSERT_EQ (nano::account (3), pending_view.source ());
+	ASSERT_EQ (nano::amount (4), pending_view.amount ());
+	ASSERT_EQ (nano::epoch::epoch_1, pending_view.epoch ());
+}
+
 /**
  * Regression test for Issue 1164
  * This reconstructs the situation where a key is larger in pending than the account being iterated in pending_v1, leaving
@@ -689,6 +727,39 @@ TEST (mdb_block_store, bad_path)
 	ASSERT_TRUE (false);
 }
 
+// Waiting for durability syncs right away instead of waiting for the interval
+TEST (mdb_block_store, group_commit)
+{
+	if (nano::rocksdb_config::using_rocksdb_in_tests ())
+	{
+		// Don't test this in rocksdb mode
+		GTEST_SKIP ();
+	}
+	nano::logger logger;
+	auto path = nano::unique_path () / "data.ldb";
+	nano::endpoint_key endpoint (boost::asio::ip::address_v6::any ().to_bytes (), 100);
+	{
+		nano::lmdb_config config;
+		config.sync = nano::lmdb_config::sync_strategy::group_commit;
+		config.sync_interval = std::chrono::hours{ 1 };
+		config.sync_max_pending = 0;
+		nano::store::lmdb::component store (logger, path, nano::dev::constants, nano::txn_tracking_config{}, std::chrono::milliseconds (5000), config);
+		ASSERT_FALSE (store.init_error ());
+		{
+			auto transaction = store.tx_begin_write ();
+			store.peer.put (transaction, endpoint, 37);
+		}
+		auto start = std::chrono::steady_clock::now ();
+		ASSERT_FALSE (store.flush ());
+		ASSERT_LT (std::chrono::steady_clock::now () - start, std::chrono::seconds{ 5 });
+		// Nothing left to sync
+		ASSERT_FALSE (store.flush ());
+	}
+	nano::store::lmdb::component store (logger, path, nano::dev::constants);
+	ASSERT_FALSE (store.init_error ());
+	ASSERT_TRUE (store.peer.exists (store.tx_begin_read (), endpoint));
+}
+
 TEST (block_store, DISABLED_already_open) // File can be shared
 {
 	auto path (nano::unique_path ());
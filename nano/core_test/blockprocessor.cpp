@@ -9,4 +9,101 @@
 
 #include <gtest/gtest.h>
 
-using namespace std::chrono_literals;
\ No newline at end of file
+using namespace std::chrono_literals;
+
+// Blocks already in the ledger are resolved by the read-only stage and never reach the write transaction
+TEST (block_processor, precheck_existing)
+{
+	nano::test::system system{ 1 };
+	auto & node = *system.nodes[0];
+	nano::keypair key;
+	nano::state_block_builder builder;
+	auto send = builder.make_block ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - nano::Knano_ratio)
+				.link (key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*system.work.generate (nano::dev::genesis->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::progress, node.process_local (send).value ());
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::blockprocessor, nano::stat::detail::precheck_existing));
+	ASSERT_EQ (nano::block_status::old, node.process_local (send).value ());
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::blockprocessor, nano::stat::detail::precheck_existing));
+	ASSERT_EQ (1, node.stats.count (nano::stat::type::ledger, nano::stat::detail::old));
+}
+
+// Bootstrap blocks of several account chains are prepared on the workers and still end up applied in order
+TEST (block_processor, bootstrap_threads)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.block_processor.bootstrap_threads = 2;
+	auto & node = *system.add_node (config);
+
+	size_t const chains = 8;
+	size_t const length = 4;
+	nano::state_block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> sends;
+	std::vector<std::vector<std::shared_ptr<nano::block>>> accounts;
+	auto previous = nano::dev::genesis->hash ();
+	auto balance = nano::dev::constants.genesis_amount;
+	for (size_t i = 0; i < chains; ++i)
+	{
+		nano::keypair key;
+		balance -= length * nano::Knano_ratio;
+		auto send = builder.make_block ()
+					.account (nano::dev::genesis_key.pub)
+					.previous (previous)
+					.representative (nano::dev::genesis_key.pub)
+					.balance (balance)
+					.link (key.pub)
+					.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+					.work (*system.work.generate (previous))
+					.build ();
+		previous = send->hash ();
+		sends.push_back (send);
+
+		// Open with the whole amount, then send it back in small steps
+		std::vector<std::shared_ptr<nano::block>> chain;
+		auto chain_previous = send->hash ();
+		for (size_t j = 0; j < length; ++j)
+		{
+			auto block = builder.make_block ()
+						 .account (key.pub)
+						 .previous (j == 0 ? 0 : chain_previous)
+						 .representative (key.pub)
+						 .balance ((length - j) * nano::Knano_ratio)
+						 .link (j == 0 ? nano::link{ send->hash () } : nano::link{ nano::dev::genesis_key.pub })
+						 .sign (key.prv, key.pub)
+						 .work (*system.work.generate (j == 0 ? nano::root{ key.pub } : nano::root{ chain_previous }))
+						 .build ();
+			chain_previous = block->hash ();
+			chain.push_back (block);
+		}
+		accounts.push_back (chain);
+	}
+	ASSERT_TRUE (nano::test::process (node, sends));
+
+	// Interleave chains the way bootstrap responses for different accounts arrive
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	for (size_t j = 0; j < length; ++j)
+	{
+		for (auto const & chain : accounts)
+		{
+			blocks.push_back (chain[j]);
+			ASSERT_TRUE (node.block_processor.add (chain[j], nano::block_source::bootstrap));
+		}
+	}
+	ASSERT_TIMELY (5s, nano::test::exists (node, blocks));
+	ASSERT_EQ (chains * length, node.stats.count (nano::stat::type::blockprocessor_source, nano::stat::detail::bootstrap));
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::ledger, nano::stat::detail::gap_previous));
+
+	// Duplicates are resolved by the read-only stage on the workers
+	for (auto const & block : blocks)
+	{
+		ASSERT_TRUE (node.block_processor.add (block, nano::block_source::bootstrap));
+	}
+	ASSERT_TIMELY_EQ (5s, chains * length, node.stats.count (nano::stat::type::blockprocessor, nano::stat::detail::precheck_existing));
+}
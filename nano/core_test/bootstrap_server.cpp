@@ -18,7 +18,7 @@ public:
 	void add (nano::asc_pull_ack const & ack)
 	{
 		nano::lock_guard<nano::mutex> lock{ mutex };
-		responses.push_back (ack);
+		responses.push_back (decode (ack));
 	}
 
 	std::vector<nano::asc_pull_ack> get ()
@@ -41,6 +41,26 @@ public:
 	}
 
 private:
+	/**
+	 * The server sends blocks pre-serialized, decode them the same way a peer would so tests can inspect them
+	 */
+	static nano::asc_pull_ack decode (nano::asc_pull_ack ack)
+	{
+		if (auto payload = std::get_if<nano::asc_pull_ack::blocks_payload> (&ack.payload))
+		{
+			std::vector<uint8_t> bytes;
+			{
+				nano::vectorstream stream{ bytes };
+				payload->serialize (stream);
+			}
+			nano::bufferstream stream{ bytes.data (), bytes.size () };
+			nano::asc_pull_ack::blocks_payload decoded{};
+			decoded.deserialize (stream);
+			ack.payload = decoded;
+		}
+		return ack;
+	}
+
 	nano::mutex mutex;
 	std::vector<nano::asc_pull_ack> responses;
 };
@@ -42,19 +42,17 @@ TEST (confirmation_solicitor, batches)
 				.work (*system.work.generate (nano::dev::genesis->hash ()))
 				.build ();
 	send->sideband_set ({});
+	// Elections are created directly and never inserted into the container, so no shard needs to be held
+	for (size_t i (0); i < nano::network::confirm_req_hashes_max; ++i)
 	{
-		nano::lock_guard<nano::mutex> guard (node2.active.mutex);
-		for (size_t i (0); i < nano::network::confirm_req_hashes_max; ++i)
-		{
-			auto election (std::make_shared<nano::election> (node2, send, nullptr, nullptr, nano::election_behavior::priority));
-			ASSERT_FALSE (solicitor.add (*election));
-		}
-		// Reached the maximum amount of requests for the channel
 		auto election (std::make_shared<nano::election> (node2, send, nullptr, nullptr, nano::election_behavior::priority));
-		// Broadcasting should be immediate
-		ASSERT_EQ (0, node2.stats.count (nano::stat::type::message, nano::stat::detail::publish, nano::stat::dir::out));
-		ASSERT_FALSE (solicitor.broadcast (*election));
+		ASSERT_FALSE (solicitor.add (*election));
 	}
+	// Reached the maximum amount of requests for the channel
+	auto election (std::make_shared<nano::election> (node2, send, nullptr, nullptr, nano::election_behavior::priority));
+	// Broadcasting should be immediate
+	ASSERT_EQ (0, node2.stats.count (nano::stat::type::message, nano::stat::detail::publish, nano::stat::dir::out));
+	ASSERT_FALSE (solicitor.broadcast (*election));
 	// One publish through directed broadcasting and another through random flooding
 	ASSERT_EQ (2, node2.stats.count (nano::stat::type::message, nano::stat::detail::publish, nano::stat::dir::out));
 	solicitor.flush ();
@@ -94,7 +92,7 @@ TEST (confirmation_solicitor, different_hash)
 	send->sideband_set ({});
 	auto election (std::make_shared<nano::election> (node2, send, nullptr, nullptr, nano::election_behavior::priority));
 	// Add a vote for something else, not the winner
-	election->last_votes[representative.account] = { std::chrono::steady_clock::now (), 1, 1 };
+	election->set_last_vote (representative.account, { std::chrono::steady_clock::now (), 1, 1 });
 	// Ensure the request and broadcast goes through
 	ASSERT_FALSE (solicitor.add (*election));
 	ASSERT_FALSE (solicitor.broadcast (*election));
@@ -68,6 +68,53 @@ TEST (confirming_set, process_multiple)
 	ASSERT_EQ (3, ctx.ledger ().cemented_count ());
 }
 
+// Hashes from many independent accounts are planned by multiple threads and cemented in one pass
+TEST (confirming_set, process_parallel_plan)
+{
+	auto ctx = nano::test::ledger_diamond (4);
+	nano::confirming_set_config config{};
+	config.planner_threads = 4;
+	nano::confirming_set confirming_set{ config, ctx.ledger (), ctx.stats () };
+	std::atomic<std::size_t> count = 0;
+	std::mutex mutex;
+	std::condition_variable condition;
+	confirming_set.cemented_observers.add ([&] (auto const &) { ++count; condition.notify_all (); });
+	for (auto const & block : ctx.blocks ())
+	{
+		confirming_set.add (block->hash ());
+	}
+	nano::test::start_stop_guard guard{ confirming_set };
+	std::unique_lock lock{ mutex };
+	ASSERT_TRUE (condition.wait_for (lock, 5s, [&] () { return count == ctx.blocks ().size (); }));
+	ASSERT_EQ (ctx.blocks ().size () + 1, ctx.ledger ().cemented_count ());
+	ASSERT_EQ (ctx.blocks ().size (), ctx.stats ().count (nano::stat::type::confirming_set, nano::stat::detail::cemented_hash));
+	ASSERT_EQ (0, ctx.stats ().count (nano::stat::type::confirming_set, nano::stat::detail::plan_fallback));
+}
+
+// Planning shares `max_blocks` across the whole batch, hashes left without a plan are cemented directly
+TEST (confirming_set, plan_budget)
+{
+	auto ctx = nano::test::ledger_diamond (4);
+	nano::confirming_set_config config{};
+	config.planner_threads = 4;
+	config.max_blocks = 2;
+	nano::confirming_set confirming_set{ config, ctx.ledger (), ctx.stats () };
+	std::atomic<std::size_t> count = 0;
+	std::mutex mutex;
+	std::condition_variable condition;
+	confirming_set.cemented_observers.add ([&] (auto const &) { ++count; condition.notify_all (); });
+	for (auto const & block : ctx.blocks ())
+	{
+		confirming_set.add (block->hash ());
+	}
+	nano::test::start_stop_guard guard{ confirming_set };
+	std::unique_lock lock{ mutex };
+	ASSERT_TRUE (condition.wait_for (lock, 5s, [&] () { return count == ctx.blocks ().size (); }));
+	ASSERT_EQ (ctx.blocks ().size () + 1, ctx.ledger ().cemented_count ());
+	ASSERT_EQ (ctx.blocks ().size (), ctx.stats ().count (nano::stat::type::confirming_set, nano::stat::detail::cemented_hash));
+	ASSERT_LT (0, ctx.stats ().count (nano::stat::type::confirming_set, nano::stat::detail::plan_fallback));
+}
+
 TEST (confirmation_callback, observer_callbacks)
 {
 	nano::test::system system;
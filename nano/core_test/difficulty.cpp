@@ -148,3 +148,48 @@ TEST (difficulty, network_constants)
 	// Epoch
 	ASSERT_EQ (nano::dev::network_params.work.epoch_2_receive, nano::dev::network_params.work.threshold (version, nano::block_details (nano::epoch::epoch_2, false, false, true)));
 }
+
+TEST (difficulty, validate_batch)
+{
+	auto & work = nano::dev::network_params.work;
+	nano::block_builder builder;
+	std::vector<std::shared_ptr<nano::block>> blocks;
+	// More blocks than a single hashing chunk
+	for (auto i = 0; i < 40; ++i)
+	{
+		nano::keypair key;
+		auto block = builder
+					 .state ()
+					 .account (key.pub)
+					 .previous (0)
+					 .representative (key.pub)
+					 .balance (1)
+					 .link (i + 1)
+					 .sign (key.prv, key.pub)
+					 .work (0)
+					 .build ();
+		uint64_t nonce = 0;
+		while (work.validate_entry (*block))
+		{
+			block->block_work_set (++nonce);
+		}
+		blocks.push_back (block);
+	}
+	std::vector<nano::block const *> pointers;
+	for (auto const & block : blocks)
+	{
+		pointers.push_back (block.get ());
+	}
+	ASSERT_FALSE (work.validate_batch (pointers));
+	ASSERT_FALSE (work.validate_batch ({}));
+
+	// Invalidate work of a block in the second chunk
+	auto & invalid = blocks[35];
+	uint64_t nonce = 0;
+	while (!work.validate_entry (*invalid))
+	{
+		invalid->block_work_set (++nonce);
+	}
+	ASSERT_TRUE (work.validate_batch (pointers));
+	ASSERT_FALSE (work.validate_batch (std::span{ pointers }.first (35)));
+}
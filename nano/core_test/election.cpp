@@ -307,3 +307,65 @@ TEST (election, continuous_voting)
 	// Ensure votes are broadcasted in continuous manner
 	ASSERT_TIMELY (5s, node1.stats.count (nano::stat::type::election, nano::stat::detail::broadcast_vote) >= 5);
 }
+
+// The running tally must follow a representative switching its vote between forks
+TEST (election, tally_follows_vote_change)
+{
+	nano::test::system system;
+	nano::node_config node_config = system.default_config ();
+	node_config.online_weight_minimum = nano::dev::constants.genesis_amount;
+	node_config.backlog_population.enable = false;
+	auto & node = *system.add_node (node_config);
+	nano::state_block_builder builder;
+
+	auto send1 = builder.make_block ()
+				 .previous (nano::dev::genesis->hash ())
+				 .account (nano::dev::genesis_key.pub)
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (nano::keypair{}.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .build ();
+
+	auto send2 = builder.make_block ()
+				 .previous (nano::dev::genesis->hash ())
+				 .account (nano::dev::genesis_key.pub)
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 2)
+				 .link (nano::keypair{}.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .build ();
+
+	node.process_active (send1);
+	std::shared_ptr<nano::election> election;
+	ASSERT_TIMELY (5s, (election = node.active.election (send1->qualified_root ())) != nullptr);
+	node.process_active (send2);
+	ASSERT_TIMELY_EQ (5s, election->blocks ().size (), 2);
+
+	auto const weight = node.ledger.weight (nano::dev::genesis_key.pub);
+
+	// Cached votes bypass the cooldown, allowing the representative to switch immediately
+	ASSERT_EQ (nano::vote_code::vote, election->vote (nano::dev::genesis_key.pub, 1, send1->hash (), nano::vote_source::cache));
+	auto tally1 = election->tally ();
+	ASSERT_EQ (weight, tally1.begin ()->first);
+	ASSERT_EQ (*send1, *tally1.begin ()->second);
+
+	ASSERT_EQ (nano::vote_code::vote, election->vote (nano::dev::genesis_key.pub, 2, send2->hash (), nano::vote_source::cache));
+	auto tally2 = election->tally ();
+	ASSERT_EQ (weight, tally2.begin ()->first);
+	ASSERT_EQ (*send2, *tally2.begin ()->second);
+	// Weight of the previous vote must be moved, not duplicated
+	nano::uint128_t sum = 0;
+	for (auto const & [amount, block] : tally2)
+	{
+		sum += amount;
+	}
+	ASSERT_EQ (weight, sum);
+
+	ASSERT_EQ (nano::vote_code::vote, election->vote (nano::dev::genesis_key.pub, std::numeric_limits<uint64_t>::max (), send2->hash (), nano::vote_source::cache));
+	ASSERT_TIMELY (5s, election->confirmed ());
+	ASSERT_EQ (*send2, *election->winner ());
+	ASSERT_EQ (weight, election->get_status ().final_tally);
+}
@@ -1,3 +1,4 @@
+#include <nano/node/concurrent_fair_queue.hpp>
 #include <nano/node/fair_queue.hpp>
 #include <nano/test_common/system.hpp>
 #include <nano/test_common/testutil.hpp>
@@ -5,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <ranges>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -277,3 +279,87 @@ TEST (fair_queue, cleanup)
 	ASSERT_TRUE (queue.empty ());
 	ASSERT_EQ (queue.queues_size (), 2);
 }
+
+TEST (concurrent_fair_queue, round_robin_with_priority)
+{
+	nano::concurrent_fair_queue<int, source_enum> queue;
+	queue.priority_query = [] (auto const & origin) {
+		switch (origin.source)
+		{
+			case source_enum::live:
+				return 1;
+			case source_enum::bootstrap:
+				return 2;
+			default:
+				return 0;
+		}
+	};
+	queue.max_size_query = [] (auto const &) { return 2; };
+
+	ASSERT_TRUE (queue.push (7, { source_enum::live }));
+	ASSERT_TRUE (queue.push (8, { source_enum::live }));
+	ASSERT_FALSE (queue.push (9, { source_enum::live })); // Full
+	ASSERT_TRUE (queue.push (10, { source_enum::bootstrap }));
+	ASSERT_TRUE (queue.push (11, { source_enum::bootstrap }));
+	ASSERT_EQ (queue.size (), 4);
+	ASSERT_EQ (queue.queues_size (), 2);
+	ASSERT_EQ (queue.size ({ source_enum::live }), 2);
+
+	// Processing 1x live, 2x bootstrap before moving to the next source
+	auto batch = queue.next_batch (999);
+	ASSERT_EQ (batch.size (), 4);
+	ASSERT_EQ (batch[0].first, 7);
+	ASSERT_EQ (batch[1].first, 10);
+	ASSERT_EQ (batch[2].first, 11);
+	ASSERT_EQ (batch[3].first, 8);
+	ASSERT_TRUE (queue.empty ());
+
+	// Ring slots are reused once popped
+	ASSERT_TRUE (queue.push (12, { source_enum::live }));
+	ASSERT_EQ (queue.next_batch (999).front ().first, 12);
+}
+
+TEST (concurrent_fair_queue, concurrent_push)
+{
+	nano::concurrent_fair_queue<int, source_enum> queue;
+	queue.priority_query = [] (auto const &) { return 1; };
+	queue.max_size_query = [] (auto const &) { return 64; };
+
+	int const producers = 4;
+	int const count = 10000;
+	std::vector<std::thread> threads;
+	for (int i = 0; i < producers; ++i)
+	{
+		threads.emplace_back ([&queue, i] () {
+			auto const source = i % 2 == 0 ? source_enum::live : source_enum::bootstrap;
+			for (int n = 0; n < count; ++n)
+			{
+				// Retry dropped requests so every value is consumed exactly once
+				while (!queue.push (i * count + n, { source }))
+				{
+					std::this_thread::yield ();
+				}
+			}
+		});
+	}
+
+	std::vector<int> last (producers, -1);
+	int received = 0;
+	while (received < producers * count)
+	{
+		for (auto const & [value, origin] : queue.next_batch (128))
+		{
+			// Requests from a single producer stay in order
+			auto const producer = value / count;
+			ASSERT_LT (last[producer], value);
+			last[producer] = value;
+			++received;
+		}
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+	ASSERT_TRUE (queue.empty ());
+	ASSERT_EQ (received, producers * count);
+}
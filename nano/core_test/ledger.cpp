@@ -20,7 +20,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <limits>
+#include <thread>
 
 using namespace std::chrono_literals;
 
@@ -704,6 +706,58 @@ TEST (ledger, delete_rep_weight_of_zero)
 	ASSERT_EQ (0, store->rep_weight.count (txn));
 }
 
+// Readers must never observe a partially written weight while the table grows and erased entries are reused
+TEST (ledger, rep_weights_concurrent_reads)
+{
+	auto store{ nano::test::make_store () };
+	nano::rep_weights rep_weights{ store->rep_weight };
+	nano::account const stable{ 1 };
+	nano::uint128_t const stable_weight{ std::numeric_limits<nano::uint128_t>::max () - 1 };
+	rep_weights.representation_put (stable, stable_weight);
+
+	std::atomic<bool> done{ false };
+	std::atomic<bool> mismatch{ false };
+	std::vector<std::thread> readers;
+	for (auto i = 0; i < 4; ++i)
+	{
+		readers.emplace_back ([&] () {
+			while (!done)
+			{
+				if (rep_weights.representation_get (stable) != stable_weight)
+				{
+					mismatch = true;
+				}
+			}
+		});
+	}
+
+	// Several times the initial table capacity, every other representative is removed again
+	size_t const count = 10000;
+	for (size_t i = 0; i < count; ++i)
+	{
+		rep_weights.representation_put (nano::account{ i + 2 }, i + 1);
+		if (i % 2 == 0)
+		{
+			rep_weights.representation_put (nano::account{ i + 2 }, 0);
+		}
+	}
+	done = true;
+	for (auto & reader : readers)
+	{
+		reader.join ();
+	}
+
+	ASSERT_FALSE (mismatch);
+	ASSERT_EQ (count / 2 + 1, rep_weights.size ());
+	for (size_t i = 0; i < count; ++i)
+	{
+		ASSERT_EQ (i % 2 == 0 ? 0 : i + 1, rep_weights.representation_get (nano::account{ i + 2 }));
+	}
+	auto const amounts = rep_weights.get_rep_amounts ();
+	ASSERT_EQ (count / 2 + 1, amounts.size ());
+	ASSERT_EQ (stable_weight, amounts.at (stable));
+}
+
 TEST (ledger, rep_cache_min_weight)
 {
 	auto store{ nano::test::make_store () };
@@ -1003,7 +1057,6 @@ TEST (votes, add_one)
 	auto existing1 (votes1.find (nano::dev::genesis_key.pub));
 	ASSERT_NE (votes1.end (), existing1);
 	ASSERT_EQ (send1->hash (), existing1->second.hash);
-	nano::lock_guard<nano::mutex> guard{ node1.active.mutex };
 	auto winner (*election1->tally ().begin ());
 	ASSERT_EQ (*send1, *winner.second);
 	ASSERT_EQ (nano::dev::constants.genesis_amount - 100, winner.first);
@@ -1037,7 +1090,7 @@ TEST (votes, add_existing)
 	ASSERT_EQ (nano::vote_code::vote, node1.vote_router.vote (vote1).at (send1->hash ()));
 	// Block is already processed from vote
 	ASSERT_TRUE (node1.active.publish (send1));
-	ASSERT_EQ (nano::vote::timestamp_min * 1, election1->last_votes[nano::dev::genesis_key.pub].timestamp);
+	ASSERT_EQ (nano::vote::timestamp_min * 1, election1->get_last_vote (nano::dev::genesis_key.pub).timestamp);
 	nano::keypair key2;
 	std::shared_ptr<nano::block> send2 = builder.state ()
 										 .account (nano::dev::genesis_key.pub)
@@ -1057,7 +1110,7 @@ TEST (votes, add_existing)
 	vote_info1.time = std::chrono::steady_clock::now () - std::chrono::seconds (20);
 	election1->set_last_vote (nano::dev::genesis_key.pub, vote_info1);
 	ASSERT_EQ (nano::vote_code::vote, node1.vote_router.vote (vote2).at (send2->hash ()));
-	ASSERT_EQ (nano::vote::timestamp_min * 2, election1->last_votes[nano::dev::genesis_key.pub].timestamp);
+	ASSERT_EQ (nano::vote::timestamp_min * 2, election1->get_last_vote (nano::dev::genesis_key.pub).timestamp);
 	// Also resend the old vote, and see if we respect the timestamp
 	auto vote_info2 = election1->get_last_vote (nano::dev::genesis_key.pub);
 	vote_info2.time = std::chrono::steady_clock::now () - std::chrono::seconds (20);
@@ -1332,6 +1385,40 @@ TEST (ledger, fail_epoch_bad_signature)
 	ASSERT_EQ (nano::block_status::progress, result2); // Succeeds with epoch signature
 }
 
+// Signature results verified ahead of time (e.g. by the block processor) are used instead of verifying again
+TEST (ledger, process_signature_verification)
+{
+	auto ctx = nano::test::ledger_empty ();
+	auto & ledger = ctx.ledger ();
+	auto transaction = ledger.tx_begin_write ();
+	auto & pool = ctx.pool ();
+	nano::block_builder builder;
+	auto send = builder
+				.state ()
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - 1)
+				.link (nano::dev::genesis_key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*pool.generate (nano::dev::genesis->hash ()))
+				.build ();
+	ASSERT_EQ (nano::block_status::bad_signature, ledger.process (transaction, send, nano::signature_verification::invalid));
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, send, nano::signature_verification::valid));
+	auto epoch = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 1)
+				 .link (ledger.epoch_link (nano::epoch::epoch_1))
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*pool.generate (send->hash ()))
+				 .build ();
+	ASSERT_EQ (nano::block_status::bad_signature, ledger.process (transaction, epoch, nano::signature_verification::invalid));
+	ASSERT_EQ (nano::block_status::progress, ledger.process (transaction, epoch, nano::signature_verification::valid_epoch));
+}
+
 TEST (ledger, fail_change_bad_signature)
 {
 	auto ctx = nano::test::ledger_empty ();
@@ -4866,6 +4953,41 @@ TEST (ledger, cache)
 	}
 }
 
+TEST (ledger, cache_snapshot)
+{
+	auto ctx = nano::test::ledger_send_receive ();
+	auto & ledger = ctx.ledger ();
+	auto & store = ctx.store ();
+	auto & stats = ctx.stats ();
+	ledger.save_cache ();
+	ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_saved));
+
+	auto cache_check = [&] (nano::ledger const & other) {
+		ASSERT_EQ (ledger.account_count (), other.account_count ());
+		ASSERT_EQ (ledger.block_count (), other.block_count ());
+		ASSERT_EQ (ledger.cemented_count (), other.cemented_count ());
+		ASSERT_EQ (ledger.pruned_count (), other.pruned_count ());
+		ASSERT_EQ (ledger.cache.rep_weights.get_rep_amounts (), other.cache.rep_weights.get_rep_amounts ());
+	};
+
+	// Store is unchanged since the snapshot was saved
+	cache_check (nano::ledger (store, stats, nano::dev::constants));
+	ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_loaded));
+
+	// Snapshot does not contain representatives below its own minimum weight
+	nano::ledger ledger_min_weight (store, stats, nano::dev::constants, nano::generate_cache_flags{}, 1);
+	ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_invalid));
+
+	// Any write after saving makes the snapshot stale and the cache is rebuilt from the ledger
+	{
+		auto transaction = store.tx_begin_write ();
+		store.online_weight.put (transaction, 1, 2);
+	}
+	cache_check (nano::ledger (store, stats, nano::dev::constants));
+	ASSERT_EQ (1, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_loaded));
+	ASSERT_EQ (2, stats.count (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_invalid));
+}
+
 TEST (ledger, pruning_action)
 {
 	nano::logger logger;
@@ -5545,6 +5667,38 @@ TEST (ledger, cement_unbounded)
 	}));
 }
 
+// Tests that a plan made with a read transaction cements the same blocks as a direct call
+TEST (ledger, cement_plan)
+{
+	auto ctx = nano::test::ledger_diamond (4);
+	auto & ledger = ctx.ledger ();
+	auto bottom = ctx.blocks ().back ();
+
+	std::unordered_set<nano::block_hash> planned;
+	auto plan = ledger.confirm_plan (ledger.tx_begin_read (), bottom->hash (), planned);
+	ASSERT_EQ (ctx.blocks ().size (), plan.size ());
+	ASSERT_EQ (bottom->hash (), plan.back ()->hash ());
+	// Blocks already planned are not planned again
+	ASSERT_TRUE (ledger.confirm_plan (ledger.tx_begin_read (), ctx.blocks ().front ()->hash (), planned).empty ());
+	ASSERT_FALSE (ledger.confirmed.block_exists (ledger.tx_begin_read (), bottom->hash ()));
+
+	{
+		auto tx = ledger.tx_begin_write ();
+		// Dependencies are not confirmed yet
+		ASSERT_FALSE (ledger.confirm_planned (tx, *bottom));
+		for (auto const & block : plan)
+		{
+			ASSERT_TRUE (ledger.confirm_planned (tx, *block));
+		}
+		// Already confirmed
+		ASSERT_FALSE (ledger.confirm_planned (tx, *bottom));
+	}
+	ASSERT_TRUE (std::all_of (ctx.blocks ().begin (), ctx.blocks ().end (), [&] (auto const & block) {
+		return ledger.confirmed.block_exists (ledger.tx_begin_read (), block->hash ());
+	}));
+	ASSERT_EQ (ctx.blocks ().size () + 1, ledger.cemented_count ());
+}
+
 // Tests that bounded cementing works when recursion stack is large
 TEST (ledger, cement_bounded)
 {
@@ -53,6 +53,114 @@ TEST (ledger_confirm, single)
 	ASSERT_EQ (2, node->ledger.cemented_count ());
 }
 
+TEST (ledger_confirm, unconfirmed_accounts)
+{
+	nano::test::system system;
+	nano::node_config node_config = system.default_config ();
+	node_config.backlog_population.enable = false;
+	auto node = system.add_node (node_config);
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto send1 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 100)
+				 .link (key1.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	auto send2 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 200)
+				 .link (key1.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (send1->hash ()))
+				 .build ();
+	auto & unconfirmed = node->ledger.cache.unconfirmed;
+	auto transaction = node->ledger.tx_begin_write ();
+	ASSERT_FALSE (unconfirmed.exists (nano::dev::genesis_key.pub));
+	ASSERT_EQ (nano::block_status::progress, node->ledger.process (transaction, send1));
+	ASSERT_EQ (nano::block_status::progress, node->ledger.process (transaction, send2));
+	ASSERT_TRUE (unconfirmed.exists (nano::dev::genesis_key.pub));
+
+	// Partially cementing the chain keeps the account indexed
+	node->ledger.confirm (transaction, send1->hash ());
+	ASSERT_TRUE (unconfirmed.exists (nano::dev::genesis_key.pub));
+
+	// Rolling back down to the confirmation height is tracked conservatively, the entry is dropped once the chain is known to be cemented
+	ASSERT_FALSE (node->ledger.rollback (transaction, send2->hash ()));
+	ASSERT_TRUE (unconfirmed.exists (nano::dev::genesis_key.pub));
+	unconfirmed.erase (nano::dev::genesis_key.pub, 2);
+	ASSERT_FALSE (unconfirmed.exists (nano::dev::genesis_key.pub));
+
+	// A stale erase does not drop an account whose chain has grown since it was read
+	ASSERT_EQ (nano::block_status::progress, node->ledger.process (transaction, send2));
+	unconfirmed.erase (nano::dev::genesis_key.pub, 2);
+	ASSERT_TRUE (unconfirmed.exists (nano::dev::genesis_key.pub));
+
+	node->ledger.confirm (transaction, send2->hash ());
+	ASSERT_FALSE (unconfirmed.exists (nano::dev::genesis_key.pub));
+}
+
+// A backlog scan reading an account before a concurrent block insert must not overwrite the longer chain the ledger recorded
+TEST (ledger_confirm, unconfirmed_accounts_stale_scan)
+{
+	nano::test::system system;
+	nano::node_config node_config = system.default_config ();
+	node_config.backlog_population.enable = false;
+	auto node = system.add_node (node_config);
+	nano::keypair key1;
+	nano::block_builder builder;
+	auto send1 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (nano::dev::genesis->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 100)
+				 .link (key1.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (nano::dev::genesis->hash ()))
+				 .build ();
+	auto send2 = builder
+				 .state ()
+				 .account (nano::dev::genesis_key.pub)
+				 .previous (send1->hash ())
+				 .representative (nano::dev::genesis_key.pub)
+				 .balance (nano::dev::constants.genesis_amount - 200)
+				 .link (key1.pub)
+				 .sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				 .work (*system.work.generate (send1->hash ()))
+				 .build ();
+	auto & unconfirmed = node->ledger.cache.unconfirmed;
+	ASSERT_EQ (nano::block_status::progress, node->ledger.process (node->ledger.tx_begin_write (), send1));
+
+	// The scan reads the account while its chain is two blocks long
+	auto const scanned = node->ledger.any.account_get (node->ledger.tx_begin_read (), nano::dev::genesis_key.pub);
+	ASSERT_TRUE (scanned);
+	ASSERT_EQ (2, scanned->block_count);
+
+	// A block is inserted before the scan records what it read
+	auto transaction = node->ledger.tx_begin_write ();
+	ASSERT_EQ (nano::block_status::progress, node->ledger.process (transaction, send2));
+	unconfirmed.put_if_absent (nano::dev::genesis_key.pub, scanned->block_count);
+
+	// Cementing the first block does not drop the account, send2 is still unconfirmed
+	node->ledger.confirm (transaction, send1->hash ());
+	ASSERT_TRUE (unconfirmed.exists (nano::dev::genesis_key.pub));
+
+	node->ledger.confirm (transaction, send2->hash ());
+	ASSERT_FALSE (unconfirmed.exists (nano::dev::genesis_key.pub));
+
+	// Accounts the ledger has not recorded are added by the scan
+	unconfirmed.put_if_absent (key1.pub, 1);
+	ASSERT_TRUE (unconfirmed.exists (key1.pub));
+}
+
 TEST (ledger_confirm, multiple_accounts)
 {
 	nano::test::system system;
@@ -17,6 +17,7 @@ auto message_deserializer_success_checker (message_type & message_original) -> v
 	nano::network_filter filter (1);
 	nano::block_uniquer block_uniquer;
 	nano::vote_uniquer vote_uniquer;
+	nano::transport::receive_buffer_pool buffer_pool;
 
 	// Data used to simulate the incoming buffer to be deserialized, the offset tracks how much has been read from the input_source
 	// as the read function is called first to read the header, then called again to read the payload.
@@ -24,7 +25,7 @@ auto message_deserializer_success_checker (message_type & message_original) -> v
 	std::size_t offset{ 0 };
 
 	// Message Deserializer with the query function tweaked to read from the `input_source`.
-	auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer,
+	auto const message_deserializer = std::make_shared<nano::transport::message_deserializer> (nano::dev::network_params.network, filter, block_uniquer, vote_uniquer, buffer_pool,
 	[&input_source, &offset] (std::shared_ptr<std::vector<uint8_t>> const & data_a, std::size_t size_a, std::function<void (boost::system::error_code const &, std::size_t)> callback_a) {
 		debug_assert (input_source.size () >= size_a);
 		data_a->resize (size_a);
@@ -203,3 +204,22 @@ TEST (message_deserializer, exact_asc_pull_ack)
 
 	message_deserializer_success_checker<decltype (message)> (message);
 }
+
+TEST (message_deserializer, receive_buffer_pool)
+{
+	nano::transport::receive_buffer_pool pool{ 1 };
+	auto buffer1 = pool.acquire (64);
+	ASSERT_GE (buffer1->size (), 64);
+	ASSERT_EQ (0, pool.size ());
+	auto buffer2 = pool.acquire (128);
+	pool.release (buffer1);
+	ASSERT_EQ (1, pool.size ());
+	// Pool is full
+	pool.release (buffer2);
+	ASSERT_EQ (1, pool.size ());
+	// Released buffers are reused and grown when needed
+	auto buffer3 = pool.acquire (256);
+	ASSERT_EQ (buffer1, buffer3);
+	ASSERT_GE (buffer3->size (), 256);
+	ASSERT_EQ (0, pool.size ());
+}
@@ -0,0 +1,68 @@
+#include <nano/lib/numbers.hpp>
+#include <nano/node/signatures.hpp>
+#include <nano/secure/common.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+nano::signature_check_set make_check_set (std::size_t count, std::vector<std::size_t> const & invalid)
+{
+	nano::signature_check_set result;
+	nano::keypair key;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		nano::uint256_union message{ i };
+		auto signature = nano::sign_message (key.prv, key.pub, message);
+		if (std::find (invalid.begin (), invalid.end (), i) != invalid.end ())
+		{
+			signature.bytes[32] ^= 0x1;
+		}
+		result.add (message, key.pub, signature);
+	}
+	return result;
+}
+}
+
+TEST (signature_checker, empty)
+{
+	nano::signature_checker checker{ 0 };
+	nano::signature_check_set check_set;
+	checker.verify (check_set);
+	ASSERT_TRUE (check_set.empty ());
+}
+
+TEST (signature_checker, calling_thread)
+{
+	nano::signature_checker checker{ 0 };
+	auto check_set = make_check_set (10, { 3, 7 });
+	checker.verify (check_set);
+	for (std::size_t i = 0; i < check_set.size (); ++i)
+	{
+		ASSERT_EQ (check_set.valid (i), i != 3 && i != 7);
+	}
+}
+
+TEST (signature_checker, many_threads)
+{
+	nano::signature_checker checker{ 4 };
+	std::vector<std::size_t> invalid{ 0, 63, 64, 500, 1023 };
+	auto check_set = make_check_set (1024, invalid);
+	checker.verify (check_set);
+	for (std::size_t i = 0; i < check_set.size (); ++i)
+	{
+		ASSERT_EQ (check_set.valid (i), std::find (invalid.begin (), invalid.end (), i) == invalid.end ());
+	}
+}
+
+TEST (signature_checker, stopped)
+{
+	nano::signature_checker checker{ 2 };
+	checker.stop ();
+	auto check_set = make_check_set (512, { 100 });
+	checker.verify (check_set);
+	for (std::size_t i = 0; i < check_set.size (); ++i)
+	{
+		ASSERT_EQ (check_set.valid (i), i != 100);
+	}
+}
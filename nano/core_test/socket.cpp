@@ -737,3 +737,33 @@ TEST (socket_timeout, write_overlapped)
 	// check that the socket was closed due to tcp_io_timeout timeout
 	ASSERT_EQ (1, node->stats.count (nano::stat::type::tcp, nano::stat::detail::tcp_io_timeout_drop, nano::stat::dir::out));
 }
+
+// Queued buffers are coalesced into batches in priority order, limited by size
+TEST (socket_queue, pop_batch)
+{
+	nano::transport::socket_queue queue{ 16 };
+	auto buffer = [] (std::size_t size) {
+		return nano::shared_const_buffer{ std::vector<uint8_t> (size, 0) };
+	};
+	ASSERT_TRUE (queue.insert (buffer (40), nullptr, nano::transport::traffic_type::bootstrap));
+	ASSERT_TRUE (queue.insert (buffer (10), nullptr, nano::transport::traffic_type::generic));
+	ASSERT_TRUE (queue.insert (buffer (20), nullptr, nano::transport::traffic_type::generic));
+	ASSERT_TRUE (queue.insert (buffer (200), nullptr, nano::transport::traffic_type::generic));
+
+	auto batch1 = queue.pop_batch (100);
+	ASSERT_EQ (2, batch1.size ());
+	ASSERT_EQ (10, batch1[0].buffer.size ());
+	ASSERT_EQ (20, batch1[1].buffer.size ());
+
+	// An entry larger than the limit is still returned on its own
+	auto batch2 = queue.pop_batch (100);
+	ASSERT_EQ (1, batch2.size ());
+	ASSERT_EQ (200, batch2[0].buffer.size ());
+
+	auto batch3 = queue.pop_batch (100);
+	ASSERT_EQ (1, batch3.size ());
+	ASSERT_EQ (40, batch3[0].buffer.size ());
+
+	ASSERT_TRUE (queue.empty ());
+	ASSERT_TRUE (queue.pop_batch (100).empty ());
+}
@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 
 #include <ostream>
+#include <thread>
 
 // Test stat counting at both type and detail levels
 TEST (stats, counters)
@@ -45,6 +46,37 @@ TEST (stats, counters_aggregate_all)
 	ASSERT_EQ (1, node.stats.count (nano::stat::type::ledger, nano::stat::detail::test, nano::stat::dir::in));
 }
 
+// Counters updated from many threads are summed across shards
+TEST (stats, counters_concurrent)
+{
+	nano::test::system system;
+	auto & node = *system.add_node ();
+	node.stats.clear ();
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 16; ++i)
+	{
+		threads.emplace_back ([&node] () {
+			for (int n = 0; n < 1000; ++n)
+			{
+				node.stats.inc (nano::stat::type::test, nano::stat::detail::test, nano::stat::dir::out, true);
+			}
+		});
+	}
+	for (auto & thread : threads)
+	{
+		thread.join ();
+	}
+
+	ASSERT_EQ (16 * 1000, node.stats.count (nano::stat::type::test, nano::stat::detail::test, nano::stat::dir::out));
+	ASSERT_EQ (16 * 1000, node.stats.count (nano::stat::type::test, nano::stat::detail::all, nano::stat::dir::out));
+	ASSERT_EQ (16 * 1000, node.stats.count (nano::stat::type::test, nano::stat::dir::out));
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::test, nano::stat::dir::in));
+
+	node.stats.clear ();
+	ASSERT_EQ (0, node.stats.count (nano::stat::type::test, nano::stat::detail::test, nano::stat::dir::out));
+}
+
 TEST (stats, samples)
 {
 	nano::test::system system;
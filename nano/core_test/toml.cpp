@@ -175,6 +175,7 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.max_work_generate_multiplier, defaults.node.max_work_generate_multiplier);
 	ASSERT_EQ (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_EQ (conf.node.background_threads, defaults.node.background_threads);
+	ASSERT_EQ (conf.node.traversal_threads, defaults.node.traversal_threads);
 	ASSERT_EQ (conf.node.secondary_work_peers, defaults.node.secondary_work_peers);
 	ASSERT_EQ (conf.node.online_weight_minimum, defaults.node.online_weight_minimum);
 	ASSERT_EQ (conf.node.representative_vote_weight_minimum, defaults.node.representative_vote_weight_minimum);
@@ -239,11 +240,19 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.lmdb_config.sync, defaults.node.lmdb_config.sync);
 	ASSERT_EQ (conf.node.lmdb_config.max_databases, defaults.node.lmdb_config.max_databases);
 	ASSERT_EQ (conf.node.lmdb_config.map_size, defaults.node.lmdb_config.map_size);
+	ASSERT_EQ (conf.node.lmdb_config.sync_interval, defaults.node.lmdb_config.sync_interval);
+	ASSERT_EQ (conf.node.lmdb_config.sync_max_pending, defaults.node.lmdb_config.sync_max_pending);
 
 	ASSERT_EQ (conf.node.rocksdb_config.enable, defaults.node.rocksdb_config.enable);
 	ASSERT_EQ (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
 	ASSERT_EQ (conf.node.rocksdb_config.read_cache, defaults.node.rocksdb_config.read_cache);
 	ASSERT_EQ (conf.node.rocksdb_config.write_cache, defaults.node.rocksdb_config.write_cache);
+	ASSERT_EQ (conf.node.rocksdb_config.block_cache, defaults.node.rocksdb_config.block_cache);
+	ASSERT_EQ (conf.node.rocksdb_config.block_cache_type, defaults.node.rocksdb_config.block_cache_type);
+	ASSERT_EQ (conf.node.rocksdb_config.statistics, defaults.node.rocksdb_config.statistics);
+	ASSERT_EQ (conf.node.rocksdb_config.pending.filter_bits_per_key, defaults.node.rocksdb_config.pending.filter_bits_per_key);
+	ASSERT_EQ (conf.node.rocksdb_config.pending.prefix_length, defaults.node.rocksdb_config.pending.prefix_length);
+	ASSERT_EQ (conf.node.rocksdb_config.blocks.compression, defaults.node.rocksdb_config.blocks.compression);
 
 	ASSERT_EQ (conf.node.optimistic_scheduler.enabled, defaults.node.optimistic_scheduler.enabled);
 	ASSERT_EQ (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -263,6 +272,10 @@ TEST (toml, daemon_config_deserialize_defaults)
 	ASSERT_EQ (conf.node.block_processor.priority_live, defaults.node.block_processor.priority_live);
 	ASSERT_EQ (conf.node.block_processor.priority_bootstrap, defaults.node.block_processor.priority_bootstrap);
 	ASSERT_EQ (conf.node.block_processor.priority_local, defaults.node.block_processor.priority_local);
+	ASSERT_EQ (conf.node.block_processor.batch.min_size, defaults.node.block_processor.batch.min_size);
+	ASSERT_EQ (conf.node.block_processor.batch.max_size, defaults.node.block_processor.batch.max_size);
+	ASSERT_EQ (conf.node.block_processor.batch.target, defaults.node.block_processor.batch.target);
+	ASSERT_EQ (conf.node.block_processor.bootstrap_threads, defaults.node.block_processor.bootstrap_threads);
 
 	ASSERT_EQ (conf.node.vote_processor.max_pr_queue, defaults.node.vote_processor.max_pr_queue);
 	ASSERT_EQ (conf.node.vote_processor.max_non_pr_queue, defaults.node.vote_processor.max_non_pr_queue);
@@ -441,6 +454,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	lmdb_max_dbs = 999
 	network_threads = 999
 	background_threads = 999
+	traversal_threads = 999
 	online_weight_minimum = "999"
 	representative_vote_weight_minimum = "999"
 	rep_crawler_weight_minimum = "999"
@@ -478,6 +492,10 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	priority_live = 999
 	priority_bootstrap = 999
 	priority_local = 999
+	batch_min_size = 999
+	batch_max_size = 999
+	batch_target_time = 999
+	bootstrap_threads = 999
 
 	[node.active_elections]
 	size = 999
@@ -564,6 +582,8 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	sync = "nosync_safe"
 	max_databases = 999
 	map_size = 999
+	sync_interval = 999
+	sync_max_pending = 999
 
 	[node.optimistic_scheduler]
 	enable = false
@@ -582,6 +602,18 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	io_threads = 99
 	read_cache = 99
 	write_cache = 99
+	block_cache = 999
+	block_cache_type = "hyper_clock"
+	statistics = true
+
+	[node.rocksdb.blocks]
+	compression = "lz4"
+	compression_start_level = 3
+
+	[node.rocksdb.pending]
+	filter_bits_per_key = 16
+	ribbon_filter = true
+	prefix_length = 32
 
 	[node.experimental]
 	secondary_work_peers = ["dev.org:998"]
@@ -682,6 +714,7 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.max_unchecked_blocks, defaults.node.max_unchecked_blocks);
 	ASSERT_NE (conf.node.network_threads, defaults.node.network_threads);
 	ASSERT_NE (conf.node.background_threads, defaults.node.background_threads);
+	ASSERT_NE (conf.node.traversal_threads, defaults.node.traversal_threads);
 	ASSERT_NE (conf.node.secondary_work_peers, defaults.node.secondary_work_peers);
 	ASSERT_NE (conf.node.max_pruning_age, defaults.node.max_pruning_age);
 	ASSERT_NE (conf.node.max_pruning_depth, defaults.node.max_pruning_depth);
@@ -747,12 +780,22 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.lmdb_config.sync, defaults.node.lmdb_config.sync);
 	ASSERT_NE (conf.node.lmdb_config.max_databases, defaults.node.lmdb_config.max_databases);
 	ASSERT_NE (conf.node.lmdb_config.map_size, defaults.node.lmdb_config.map_size);
+	ASSERT_NE (conf.node.lmdb_config.sync_interval, defaults.node.lmdb_config.sync_interval);
+	ASSERT_NE (conf.node.lmdb_config.sync_max_pending, defaults.node.lmdb_config.sync_max_pending);
 
 	ASSERT_TRUE (conf.node.rocksdb_config.enable);
 	ASSERT_EQ (nano::rocksdb_config::using_rocksdb_in_tests (), defaults.node.rocksdb_config.enable);
 	ASSERT_NE (conf.node.rocksdb_config.io_threads, defaults.node.rocksdb_config.io_threads);
 	ASSERT_NE (conf.node.rocksdb_config.read_cache, defaults.node.rocksdb_config.read_cache);
 	ASSERT_NE (conf.node.rocksdb_config.write_cache, defaults.node.rocksdb_config.write_cache);
+	ASSERT_NE (conf.node.rocksdb_config.block_cache, defaults.node.rocksdb_config.block_cache);
+	ASSERT_NE (conf.node.rocksdb_config.block_cache_type, defaults.node.rocksdb_config.block_cache_type);
+	ASSERT_NE (conf.node.rocksdb_config.statistics, defaults.node.rocksdb_config.statistics);
+	ASSERT_NE (conf.node.rocksdb_config.blocks.compression, defaults.node.rocksdb_config.blocks.compression);
+	ASSERT_NE (conf.node.rocksdb_config.blocks.compression_start_level, defaults.node.rocksdb_config.blocks.compression_start_level);
+	ASSERT_NE (conf.node.rocksdb_config.pending.filter_bits_per_key, defaults.node.rocksdb_config.pending.filter_bits_per_key);
+	ASSERT_NE (conf.node.rocksdb_config.pending.ribbon_filter, defaults.node.rocksdb_config.pending.ribbon_filter);
+	ASSERT_NE (conf.node.rocksdb_config.pending.prefix_length, defaults.node.rocksdb_config.pending.prefix_length);
 
 	ASSERT_NE (conf.node.optimistic_scheduler.enabled, defaults.node.optimistic_scheduler.enabled);
 	ASSERT_NE (conf.node.optimistic_scheduler.gap_threshold, defaults.node.optimistic_scheduler.gap_threshold);
@@ -772,6 +815,10 @@ TEST (toml, daemon_config_deserialize_no_defaults)
 	ASSERT_NE (conf.node.block_processor.priority_live, defaults.node.block_processor.priority_live);
 	ASSERT_NE (conf.node.block_processor.priority_bootstrap, defaults.node.block_processor.priority_bootstrap);
 	ASSERT_NE (conf.node.block_processor.priority_local, defaults.node.block_processor.priority_local);
+	ASSERT_NE (conf.node.block_processor.batch.min_size, defaults.node.block_processor.batch.min_size);
+	ASSERT_NE (conf.node.block_processor.batch.max_size, defaults.node.block_processor.batch.max_size);
+	ASSERT_NE (conf.node.block_processor.batch.target, defaults.node.block_processor.batch.target);
+	ASSERT_NE (conf.node.block_processor.bootstrap_threads, defaults.node.block_processor.bootstrap_threads);
 
 	ASSERT_NE (conf.node.vote_processor.max_pr_queue, defaults.node.vote_processor.max_pr_queue);
 	ASSERT_NE (conf.node.vote_processor.max_non_pr_queue, defaults.node.vote_processor.max_non_pr_queue);
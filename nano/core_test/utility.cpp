@@ -1,17 +1,22 @@
+#include <nano/lib/json_writer.hpp>
 #include <nano/lib/optional_ptr.hpp>
 #include <nano/lib/rate_limiting.hpp>
 #include <nano/lib/thread_pool.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/lib/utility.hpp>
+#include <nano/secure/parallel_traversal.hpp>
 #include <nano/secure/pending_info.hpp>
 #include <nano/secure/utility.hpp>
 
 #include <gtest/gtest.h>
 
 #include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
 
 #include <fstream>
 #include <future>
+#include <numeric>
+#include <tuple>
 
 using namespace std::chrono_literals;
 
@@ -231,6 +236,35 @@ TEST (thread_pool_alarm, top_execution)
 	ASSERT_EQ (2, value2);
 }
 
+TEST (parallel_traversal, ordered_ranges)
+{
+	nano::thread_pool workers (4u, nano::thread_role::name::unknown);
+	nano::uint256_t const start{ 1000 };
+	auto ranges = parallel_traversal<nano::uint256_t> (workers, start, [] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
+		return std::make_tuple (begin, end, is_last);
+	});
+	ASSERT_EQ (4, ranges.size ());
+	ASSERT_EQ (start, std::get<0> (ranges.front ()));
+	for (auto i = 1; i < ranges.size (); ++i)
+	{
+		// Ranges are contiguous and returned in key order
+		ASSERT_EQ (std::get<1> (ranges[i - 1]), std::get<0> (ranges[i]));
+		ASSERT_FALSE (std::get<2> (ranges[i - 1]));
+	}
+	ASSERT_TRUE (std::get<2> (ranges.back ()));
+}
+
+TEST (parallel_traversal, stopped_pool)
+{
+	nano::thread_pool workers (4u, nano::thread_role::name::unknown);
+	workers.stop ();
+	// Ranges the pool never runs are taken by the calling thread
+	auto ranges = parallel_traversal<nano::uint256_t> (workers, 0, [] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
+		return 1;
+	});
+	ASSERT_EQ (4, std::accumulate (ranges.begin (), ranges.end (), 0));
+}
+
 TEST (filesystem, remove_all_files)
 {
 	auto path = nano::unique_path ();
@@ -360,3 +394,37 @@ TEST (pending_key, sorting)
 	ASSERT_EQ (std::hash<nano::pending_key>{}(one), std::hash<nano::pending_key>{}(one_same));
 	ASSERT_NE (std::hash<nano::pending_key>{}(one), std::hash<nano::pending_key>{}(two));
 }
+
+TEST (json_writer, property_tree_compatible)
+{
+	std::string body;
+	nano::json_writer writer{ body };
+	writer.begin_object ();
+	writer.field ("text", "quote\" backslash\\ newline\n");
+	writer.begin_object ("empty_object");
+	writer.end_object ();
+	writer.begin_array ("array");
+	writer.value ("1");
+	writer.value ("2");
+	writer.end_array ();
+	writer.begin_object ("object");
+	writer.field ("a", "b");
+	ASSERT_EQ (1, writer.size ());
+	writer.end_object ();
+	writer.end_object ();
+
+	boost::property_tree::ptree tree;
+	std::stringstream stream{ body };
+	ASSERT_NO_THROW (boost::property_tree::read_json (stream, tree));
+	ASSERT_EQ ("quote\" backslash\\ newline\n", tree.get<std::string> ("text"));
+	// Empty containers are written the way property trees write them
+	ASSERT_EQ ("", tree.get<std::string> ("empty_object"));
+	ASSERT_TRUE (tree.get_child ("empty_object").empty ());
+	std::vector<std::string> array;
+	for (auto const & [key, value] : tree.get_child ("array"))
+	{
+		array.push_back (value.data ());
+	}
+	ASSERT_EQ ((std::vector<std::string>{ "1", "2" }), array);
+	ASSERT_EQ ("b", tree.get<std::string> ("object.a"));
+}
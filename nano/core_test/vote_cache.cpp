@@ -286,6 +286,54 @@ TEST (vote_cache, erase)
 	ASSERT_TRUE (vote_cache.empty ());
 }
 
+/*
+ * Ensure that top entries reflect tally changes and erased entries
+ */
+TEST (vote_cache, top_updates)
+{
+	nano::test::system system;
+	nano::vote_cache_config cfg;
+	nano::vote_cache vote_cache{ cfg, system.stats };
+	vote_cache.rep_weight_query = rep_weight_query ();
+	auto hash1 = nano::test::random_hash ();
+	auto hash2 = nano::test::random_hash ();
+	auto rep1 = create_rep (5);
+	auto rep2 = create_rep (7);
+	auto rep3 = create_rep (10);
+	vote_cache.insert (nano::test::make_vote (rep1, { hash1 }, 1024 * 1024));
+	vote_cache.insert (nano::test::make_vote (rep2, { hash2 }, 1024 * 1024));
+
+	auto tops1 = vote_cache.top (0);
+	ASSERT_EQ (tops1.size (), 2);
+	ASSERT_EQ (tops1[0].hash, hash2);
+	ASSERT_EQ (tops1[0].tally, 7);
+
+	// Additional vote moves hash1 to the top
+	vote_cache.insert (nano::test::make_vote (rep3, { hash1 }, 1024 * 1024));
+	auto tops2 = vote_cache.top (0);
+	ASSERT_EQ (tops2.size (), 2);
+	ASSERT_EQ (tops2[0].hash, hash1);
+	ASSERT_EQ (tops2[0].tally, 15);
+	ASSERT_EQ (tops2[1].hash, hash2);
+
+	// Entries below the threshold are skipped
+	auto tops3 = vote_cache.top (10);
+	ASSERT_EQ (tops3.size (), 1);
+	ASSERT_EQ (tops3[0].hash, hash1);
+
+	// Erased entries are not returned, even when inserted again with a lower tally
+	ASSERT_TRUE (vote_cache.erase (hash1));
+	auto tops4 = vote_cache.top (0);
+	ASSERT_EQ (tops4.size (), 1);
+	ASSERT_EQ (tops4[0].hash, hash2);
+	vote_cache.insert (nano::test::make_vote (rep1, { hash1 }, 1024 * 1024));
+	auto tops5 = vote_cache.top (0);
+	ASSERT_EQ (tops5.size (), 2);
+	ASSERT_EQ (tops5[0].hash, hash2);
+	ASSERT_EQ (tops5[1].hash, hash1);
+	ASSERT_EQ (tops5[1].tally, 5);
+}
+
 /*
  * Ensure that when cache is overfilled, we remove the oldest entries first
  */
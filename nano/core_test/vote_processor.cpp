@@ -77,6 +77,30 @@ TEST (vote_processor, invalid_signature)
 	ASSERT_TIMELY_EQ (5s, 2, election->votes ().size ());
 }
 
+// Votes are signature checked together as a batch, invalid ones must not affect the rest of the batch
+TEST (vote_processor, batch_invalid_signatures)
+{
+	nano::test::system system{ 1 };
+	auto & node = *system.nodes[0];
+	auto chain = nano::test::setup_chain (system, node, 1, nano::dev::genesis_key, false);
+	auto channel = std::make_shared<nano::transport::inproc::channel> (node, node);
+
+	size_t const count = 16;
+	for (size_t i = 0; i < count; ++i)
+	{
+		nano::keypair key;
+		auto vote = std::make_shared<nano::vote> (key.pub, key.prv, nano::vote::timestamp_min * 1, 0, std::vector<nano::block_hash>{ chain[0]->hash () });
+		if (i % 4 == 0)
+		{
+			vote->signature.bytes[0] ^= 1;
+		}
+		ASSERT_TRUE (node.vote_processor.vote (vote, channel));
+	}
+
+	ASSERT_TIMELY_EQ (5s, node.stats.count (nano::stat::type::vote, nano::stat::detail::invalid), count / 4);
+	ASSERT_TIMELY_EQ (5s, node.stats.count (nano::stat::type::vote, nano::stat::detail::indeterminate), count - count / 4);
+}
+
 TEST (vote_processor, overflow)
 {
 	nano::test::system system;
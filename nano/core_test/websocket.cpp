@@ -528,6 +528,69 @@ TEST (websocket, confirmation_options_sideband)
 	}
 }
 
+// Sessions with different non-filtering options each receive the message variant they asked for
+TEST (websocket, confirmation_options_variants)
+{
+	nano::test::system system;
+	nano::node_config config = system.default_config ();
+	config.websocket_config.enabled = true;
+	config.websocket_config.port = system.get_available_port ();
+	auto node1 (system.add_node (config));
+
+	std::atomic<int> acks{ 0 };
+	auto subscribe = [&acks, &node1] (std::string const & options) {
+		return std::async (std::launch::async, [&acks, &node1, options] () {
+			fake_websocket_client client (node1->websocket.server->listening_port ());
+			client.send_message (R"json({"action": "subscribe", "topic": "confirmation", "ack": "true", "options": )json" + options + "}");
+			client.await_ack ();
+			++acks;
+			return client.get_response ();
+		});
+	};
+	auto future1 = subscribe (R"json({"include_block": "false", "include_sideband_info": "true"})json");
+	auto future2 = subscribe (R"json({"include_block": "false"})json");
+
+	ASSERT_TIMELY_EQ (10s, acks, 2);
+	ASSERT_EQ (2, node1->websocket.server->subscriber_count (nano::websocket::topic::confirmation));
+
+	system.wallet (0)->insert_adhoc (nano::dev::genesis_key.prv);
+	nano::keypair key;
+	nano::state_block_builder builder;
+	auto send = builder
+				.account (nano::dev::genesis_key.pub)
+				.previous (nano::dev::genesis->hash ())
+				.representative (nano::dev::genesis_key.pub)
+				.balance (nano::dev::constants.genesis_amount - node1->config.online_weight_minimum.number () - 1)
+				.link (key.pub)
+				.sign (nano::dev::genesis_key.prv, nano::dev::genesis_key.pub)
+				.work (*system.work.generate (nano::dev::genesis->hash ()))
+				.build ();
+	node1->process_active (send);
+
+	ASSERT_TIMELY_EQ (5s, future1.wait_for (0s), std::future_status::ready);
+	ASSERT_TIMELY_EQ (5s, future2.wait_for (0s), std::future_status::ready);
+
+	auto parse = [] (boost::optional<std::string> const & response) {
+		boost::property_tree::ptree event;
+		std::stringstream stream;
+		stream << response.get ();
+		boost::property_tree::read_json (stream, event);
+		return event;
+	};
+	auto response1 = future1.get ();
+	auto response2 = future2.get ();
+	ASSERT_TRUE (response1);
+	ASSERT_TRUE (response2);
+	auto event1 = parse (response1);
+	auto event2 = parse (response2);
+	ASSERT_EQ (send->hash ().to_string (), event1.get<std::string> ("message.hash"));
+	ASSERT_EQ (send->hash ().to_string (), event2.get<std::string> ("message.hash"));
+	ASSERT_TRUE (event1.get_child_optional ("message.sideband"));
+	ASSERT_FALSE (event2.get_child_optional ("message.sideband"));
+	ASSERT_FALSE (event1.get_child_optional ("message.block"));
+	ASSERT_FALSE (event2.get_child_optional ("message.block"));
+}
+
 // Tests updating options of block confirmations
 TEST (websocket, confirmation_options_update)
 {
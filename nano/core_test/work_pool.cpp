@@ -3,6 +3,7 @@
 #include <nano/lib/logging.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/lib/work.hpp>
+#include <nano/lib/work_hash.hpp>
 #include <nano/node/openclconfig.hpp>
 #include <nano/node/openclwork.hpp>
 #include <nano/secure/common.hpp>
@@ -54,6 +55,47 @@ TEST (work, validate)
 	ASSERT_GE (nano::dev::network_params.work.difficulty (*send_block), nano::dev::network_params.work.threshold_base (send_block->work_version ()));
 }
 
+// every SIMD engine supported by this CPU must produce the same values as the scalar blake2b implementation
+TEST (work, hash_engines)
+{
+	// Not a multiple of any lane count so padding of the last batch is exercised
+	size_t const count = 37;
+	std::vector<nano::root> roots (count);
+	std::vector<uint64_t> nonces (count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		nano::random_pool::generate_block (roots[i].bytes.data (), roots[i].bytes.size ());
+		nano::random_pool::generate_block (reinterpret_cast<uint8_t *> (&nonces[i]), sizeof (nonces[i]));
+	}
+
+	auto & work = nano::dev::network_params.work;
+	for (auto engine : { nano::work_hash::engine::scalar, nano::work_hash::engine::avx2, nano::work_hash::engine::avx512 })
+	{
+		if (!nano::work_hash::supported (engine))
+		{
+			continue;
+		}
+		std::vector<uint64_t> outputs (count);
+		nano::work_hash::values (engine, roots.data (), nonces.data (), outputs.data (), count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			ASSERT_EQ (work.value (roots[i], nonces[i]), outputs[i]) << nano::work_hash::to_string (engine);
+		}
+		nano::work_hash::values (engine, roots.front (), nonces.data (), outputs.data (), count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			ASSERT_EQ (work.value (roots.front (), nonces[i]), outputs[i]) << nano::work_hash::to_string (engine);
+		}
+	}
+
+	std::vector<uint64_t> values (count);
+	work.values (roots, nonces, values);
+	for (size_t i = 0; i < count; ++i)
+	{
+		ASSERT_EQ (work.value (roots[i], nonces[i]), values[i]);
+	}
+}
+
 // repeatedly start and cancel a work calculation and check that the callback is eventually called
 TEST (work, cancel)
 {
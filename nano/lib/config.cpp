@@ -3,6 +3,7 @@
 #include <nano/lib/config.hpp>
 #include <nano/lib/env.hpp>
 #include <nano/lib/logging.hpp>
+#include <nano/lib/work_hash.hpp>
 
 #include <boost/format.hpp>
 #include <boost/lexical_cast.hpp>
@@ -93,11 +94,22 @@ uint64_t nano::work_thresholds::value (nano::root const & root_a, uint64_t work_
 	blake2b_final (&hash, reinterpret_cast<uint8_t *> (&result), sizeof (result));
 	return result;
 }
+
+void nano::work_thresholds::values (std::span<nano::root const> roots_a, std::span<uint64_t const> works_a, std::span<uint64_t> results_a) const
+{
+	debug_assert (roots_a.size () == works_a.size () && works_a.size () == results_a.size ());
+	nano::work_hash::values (nano::work_hash::best (), roots_a.data (), works_a.data (), results_a.data (), results_a.size ());
+}
 #else
 uint64_t nano::work_thresholds::value (nano::root const & root_a, uint64_t work_a) const
 {
 	return base + 1;
 }
+
+void nano::work_thresholds::values (std::span<nano::root const> roots_a, std::span<uint64_t const> works_a, std::span<uint64_t> results_a) const
+{
+	std::fill (results_a.begin (), results_a.end (), base + 1);
+}
 #endif
 
 uint64_t nano::work_thresholds::threshold (nano::block_details const & details_a) const
@@ -220,6 +232,34 @@ bool nano::work_thresholds::validate_entry (nano::block const & block_a) const
 	return difficulty (block_a) < threshold_entry (block_a.work_version (), block_a.type ());
 }
 
+bool nano::work_thresholds::validate_batch (std::span<nano::block const * const> blocks_a) const
+{
+	// Hash in fixed size chunks so that no allocation is needed, large enough to fill the widest engine several times
+	std::size_t constexpr chunk_size = 32;
+	std::array<nano::root, chunk_size> roots;
+	std::array<uint64_t, chunk_size> works;
+	std::array<uint64_t, chunk_size> results;
+	for (std::size_t offset = 0; offset < blocks_a.size (); offset += chunk_size)
+	{
+		auto const chunk = blocks_a.subspan (offset, std::min (chunk_size, blocks_a.size () - offset));
+		for (std::size_t i = 0; i < chunk.size (); ++i)
+		{
+			debug_assert (chunk[i]->work_version () == nano::work_version::work_1);
+			roots[i] = chunk[i]->root ();
+			works[i] = chunk[i]->block_work ();
+		}
+		values ({ roots.data (), chunk.size () }, { works.data (), chunk.size () }, { results.data (), chunk.size () });
+		for (std::size_t i = 0; i < chunk.size (); ++i)
+		{
+			if (results[i] < threshold_entry (chunk[i]->work_version (), chunk[i]->type ()))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
 namespace nano
 {
 char const * network_constants::active_network_err_msg = "Invalid network. Valid values are live, test, beta and dev.";
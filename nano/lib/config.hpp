@@ -10,6 +10,7 @@
 #include <chrono>
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <string>
 
 using namespace std::chrono_literals;
@@ -146,12 +147,16 @@ public:
 	uint64_t threshold (nano::work_version const, nano::block_details const) const;
 	uint64_t threshold_base (nano::work_version const) const;
 	uint64_t value (nano::root const & root_a, uint64_t work_a) const;
+	/** Computes work values for many (root, work) pairs at once, hashing several pairs per iteration using SIMD when available */
+	void values (std::span<nano::root const> roots_a, std::span<uint64_t const> works_a, std::span<uint64_t> results_a) const;
 	double normalized_multiplier (double const, uint64_t const) const;
 	double denormalized_multiplier (double const, uint64_t const) const;
 	uint64_t difficulty (nano::work_version const, nano::root const &, uint64_t const) const;
 	uint64_t difficulty (nano::block const & block_a) const;
 	bool validate_entry (nano::work_version const, nano::root const &, uint64_t const) const;
 	bool validate_entry (nano::block const &) const;
+	/** Validates entry work of many blocks at once, returns true if any block has insufficient work */
+	bool validate_batch (std::span<nano::block const * const>) const;
 
 	/** Network work thresholds. Define these inline as constexpr when moving to cpp17. */
 	static nano::work_thresholds const publish_full;
@@ -225,6 +225,8 @@ std::string nano::error_rpc_messages::message (int ev) const
 			return "Source not found";
 		case nano::error_rpc::stopped:
 			return "Stopped";
+		case nano::error_rpc::sync_failed:
+			return "Block was processed but syncing it to disk failed";
 	}
 
 	return "Invalid error code";
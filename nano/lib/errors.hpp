@@ -121,7 +121,8 @@ enum class error_rpc
 	rpc_control_disabled,
 	sign_hash_disabled,
 	source_not_found,
-	stopped
+	stopped,
+	sync_failed
 };
 
 /** process_result related errors */
@@ -0,0 +1,141 @@
+#include <nano/lib/json_writer.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <array>
+
+nano::json_writer::json_writer (std::string & output_a) :
+	output{ output_a }
+{
+}
+
+void nano::json_writer::begin_object ()
+{
+	separator ();
+	scopes.push_back ({ output.size (), 0 });
+	output.push_back ('{');
+}
+
+void nano::json_writer::begin_object (std::string_view key_a)
+{
+	key (key_a);
+	scopes.push_back ({ output.size (), 0 });
+	output.push_back ('{');
+}
+
+void nano::json_writer::end_object ()
+{
+	end ('}');
+}
+
+void nano::json_writer::begin_array ()
+{
+	separator ();
+	scopes.push_back ({ output.size (), 0 });
+	output.push_back ('[');
+}
+
+void nano::json_writer::begin_array (std::string_view key_a)
+{
+	key (key_a);
+	scopes.push_back ({ output.size (), 0 });
+	output.push_back ('[');
+}
+
+void nano::json_writer::end_array ()
+{
+	end (']');
+}
+
+void nano::json_writer::field (std::string_view key_a, std::string_view value_a)
+{
+	key (key_a);
+	string (value_a);
+}
+
+void nano::json_writer::value (std::string_view value_a)
+{
+	separator ();
+	string (value_a);
+}
+
+std::size_t nano::json_writer::size () const
+{
+	debug_assert (!scopes.empty ());
+	return scopes.back ().size;
+}
+
+void nano::json_writer::separator ()
+{
+	if (!scopes.empty ())
+	{
+		if (scopes.back ().size++ != 0)
+		{
+			output.push_back (',');
+		}
+	}
+}
+
+void nano::json_writer::key (std::string_view key_a)
+{
+	debug_assert (!scopes.empty ());
+	separator ();
+	string (key_a);
+	output.push_back (':');
+}
+
+void nano::json_writer::string (std::string_view value_a)
+{
+	static std::array<char, 16> constexpr hex{ '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+	output.push_back ('"');
+	for (auto c : value_a)
+	{
+		switch (c)
+		{
+			case '"':
+				output.append ("\\\"");
+				break;
+			case '\\':
+				output.append ("\\\\");
+				break;
+			case '\n':
+				output.append ("\\n");
+				break;
+			case '\r':
+				output.append ("\\r");
+				break;
+			case '\t':
+				output.append ("\\t");
+				break;
+			default:
+				if (static_cast<unsigned char> (c) < 0x20)
+				{
+					output.append ("\\u00");
+					output.push_back (hex[(c >> 4) & 0xf]);
+					output.push_back (hex[c & 0xf]);
+				}
+				else
+				{
+					output.push_back (c);
+				}
+				break;
+		}
+	}
+	output.push_back ('"');
+}
+
+void nano::json_writer::end (char close)
+{
+	debug_assert (!scopes.empty ());
+	auto const scope = scopes.back ();
+	scopes.pop_back ();
+	if (scope.size == 0 && !scopes.empty ())
+	{
+		// Property trees have no notion of an empty container, keep clients that rely on it working
+		output.resize (scope.start);
+		output.append ("\"\"");
+	}
+	else
+	{
+		output.push_back (close);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nano
+{
+/**
+ * Writes JSON into a string without building a property tree first, avoiding a node per value and a second serialization pass
+ * This is not a streaming writer, the whole document is held in `output` until the caller is done with it
+ * Output is compatible with what boost::property_tree::write_json produces for the same data: every value is a string and empty
+ * objects or arrays are written as an empty string
+ */
+class json_writer final
+{
+public:
+	explicit json_writer (std::string & output);
+
+	void begin_object ();
+	void begin_object (std::string_view key);
+	void end_object ();
+	void begin_array ();
+	void begin_array (std::string_view key);
+	void end_array ();
+	/** Writes a field of the current object */
+	void field (std::string_view key, std::string_view value);
+	/** Writes an element of the current array */
+	void value (std::string_view value);
+
+	/** Number of fields or elements written to the current object or array */
+	std::size_t size () const;
+
+private:
+	void separator ();
+	void key (std::string_view);
+	void string (std::string_view);
+	void end (char close);
+
+	struct scope
+	{
+		std::size_t start;
+		std::size_t size;
+	};
+
+	std::string & output;
+	std::vector<scope> scopes;
+};
+}
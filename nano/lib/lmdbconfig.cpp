@@ -21,9 +21,14 @@ nano::error nano::lmdb_config::serialize_toml (nano::tomlconfig & toml) const
 		case nano::lmdb_config::sync_strategy::nosync_unsafe_large_memory:
 			sync_string = "nosync_unsafe_large_memory";
 			break;
+		case nano::lmdb_config::sync_strategy::group_commit:
+			sync_string = "group_commit";
+			break;
 	}
 
-	toml.put ("sync", sync_string, "Sync strategy for flushing commits to the ledger database. This does not affect the wallet database.\ntype:string,{always, nosync_safe, nosync_unsafe, nosync_unsafe_large_memory}");
+	toml.put ("sync", sync_string, "Sync strategy for flushing commits to the ledger database. This does not affect the wallet database.\ntype:string,{always, nosync_safe, nosync_unsafe, nosync_unsafe_large_memory, group_commit}");
+	toml.put ("sync_interval", sync_interval.count (), "Maximum time between syncs when using the group_commit sync strategy. Commits made since the last sync may be lost on system crash, and like nosync_unsafe the database may be corrupted on filesystems without write ordering.\ntype:milliseconds");
+	toml.put ("sync_max_pending", sync_max_pending, "Number of unsynced commits which triggers an early sync when using the group_commit sync strategy. 0 only syncs on the interval.\ntype:uint64");
 	toml.put ("max_databases", max_databases, "Maximum open lmdb databases. Increase default if more than 100 wallets is required.\nNote: external management is recommended when a large amounts of wallets are required (see https://docs.nano.org/integration-guides/key-management/).\ntype:uin32");
 	toml.put ("map_size", map_size, "Maximum ledger database map size in bytes.\ntype:uint64");
 	return toml.get_error ();
@@ -34,6 +39,10 @@ nano::error nano::lmdb_config::deserialize_toml (nano::tomlconfig & toml)
 	auto default_max_databases = max_databases;
 	toml.get_optional<uint32_t> ("max_databases", max_databases);
 	toml.get_optional<size_t> ("map_size", map_size);
+	auto sync_interval_l = sync_interval.count ();
+	toml.get_optional ("sync_interval", sync_interval_l);
+	sync_interval = std::chrono::milliseconds (sync_interval_l);
+	toml.get_optional<uint64_t> ("sync_max_pending", sync_max_pending);
 
 	if (!toml.get_error ())
 	{
@@ -55,6 +64,10 @@ nano::error nano::lmdb_config::deserialize_toml (nano::tomlconfig & toml)
 		{
 			sync = nano::lmdb_config::sync_strategy::nosync_unsafe_large_memory;
 		}
+		else if (sync_string == "group_commit")
+		{
+			sync = nano::lmdb_config::sync_strategy::group_commit;
+		}
 		else
 		{
 			toml.get_error ().set (sync_string + " is not a valid sync option");
@@ -2,6 +2,7 @@
 
 #include <nano/lib/errors.hpp>
 
+#include <chrono>
 #include <thread>
 
 namespace nano
@@ -36,7 +37,15 @@ public:
 		 * may be slower.
 		 * @warning Do not use this option if external processes uses the database concurrently.
 		 */
-		nosync_unsafe_large_memory
+		nosync_unsafe_large_memory,
+
+		/**
+		 * Commit without flushing and let a dedicated thread sync the database every sync_interval, or earlier once
+		 * sync_max_pending commits are waiting or a caller asks for durability. Between syncs this has the same guarantees
+		 * as nosync_unsafe: commits since the last sync may be lost on system crash, and on filesystems without write
+		 * ordering the database may be corrupted.
+		 */
+		group_commit
 	};
 
 	nano::error serialize_toml (nano::tomlconfig & toml_a) const;
@@ -44,6 +53,10 @@ public:
 
 	/** Sync strategy for the ledger database */
 	sync_strategy sync{ always };
+	/** Maximum time between syncs when using the group_commit strategy */
+	std::chrono::milliseconds sync_interval{ 100 };
+	/** Number of unsynced commits which triggers an early sync when using the group_commit strategy, 0 only syncs on the interval */
+	uint64_t sync_max_pending{ 256 };
 	uint32_t max_databases{ 128 };
 	size_t map_size{ 256ULL * 1024 * 1024 * 1024 };
 };
@@ -8,6 +8,20 @@ nano::error nano::rocksdb_config::serialize_toml (nano::tomlconfig & toml) const
 	toml.put ("io_threads", io_threads, "Number of threads to use with the background compaction and flushing.\ntype:uint32");
 	toml.put ("read_cache", read_cache, "Amount of megabytes per table allocated to read cache. Valid range is 1 - 1024. Default is 32.\nCarefully monitor memory usage if non-default values are used\ntype:long");
 	toml.put ("write_cache", write_cache, "Total amount of megabytes allocated to write cache. Valid range is 1 - 256. Default is 64.\nCarefully monitor memory usage if non-default values are used\ntype:long");
+	toml.put ("block_cache", block_cache, "Amount of megabytes allocated to a block cache shared by all tables. When 0, each table gets its own cache of read_cache size. Valid range is 0 - 65536.\ntype:long");
+	toml.put ("block_cache_type", block_cache_type, "Shared block cache implementation, either lru or hyper_clock.\ntype:string");
+	toml.put ("statistics", statistics, "Collect RocksDB statistics and perf counters and export them through node stats. Has a small performance cost.\ntype:bool");
+
+	auto put_table = [&toml] (std::string const & name, nano::rocksdb_table_config const & table) {
+		nano::tomlconfig table_l;
+		table.serialize_toml (table_l);
+		toml.put_child (name, table_l);
+	};
+	put_table ("blocks", blocks);
+	put_table ("accounts", accounts);
+	put_table ("pending", pending);
+	put_table ("confirmation_height", confirmation_height);
+	put_table ("rep_weights", rep_weights);
 
 	return toml.get_error ();
 }
@@ -18,6 +32,22 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 	toml.get_optional<unsigned> ("io_threads", io_threads);
 	toml.get_optional<long> ("read_cache", read_cache);
 	toml.get_optional<long> ("write_cache", write_cache);
+	toml.get_optional<long> ("block_cache", block_cache);
+	toml.get_optional<std::string> ("block_cache_type", block_cache_type);
+	toml.get_optional<bool> ("statistics", statistics);
+
+	auto get_table = [&toml] (std::string const & name, nano::rocksdb_table_config & table) {
+		if (toml.has_key (name))
+		{
+			auto table_l = toml.get_required_child (name);
+			table.deserialize_toml (table_l);
+		}
+	};
+	get_table ("blocks", blocks);
+	get_table ("accounts", accounts);
+	get_table ("pending", pending);
+	get_table ("confirmation_height", confirmation_height);
+	get_table ("rep_weights", rep_weights);
 
 	// Validate ranges
 	if (io_threads == 0)
@@ -35,6 +65,16 @@ nano::error nano::rocksdb_config::deserialize_toml (nano::tomlconfig & toml)
 		toml.get_error ().set ("write_cache must be between 1 and 256 MB");
 	}
 
+	if (block_cache < 0 || block_cache > 65536)
+	{
+		toml.get_error ().set ("block_cache must be between 0 and 65536 MB");
+	}
+
+	if (block_cache_type != "lru" && block_cache_type != "hyper_clock")
+	{
+		toml.get_error ().set ("block_cache_type must be either lru or hyper_clock");
+	}
+
 	return toml.get_error ();
 }
 
@@ -43,3 +83,44 @@ bool nano::rocksdb_config::using_rocksdb_in_tests ()
 	auto use_rocksdb_str = std::getenv ("TEST_USE_ROCKSDB");
 	return use_rocksdb_str && (boost::lexical_cast<int> (use_rocksdb_str) == 1);
 }
+
+/*
+ * rocksdb_table_config
+ */
+
+nano::error nano::rocksdb_table_config::serialize_toml (nano::tomlconfig & toml) const
+{
+	toml.put ("filter_bits_per_key", filter_bits_per_key, "Bits per key of the point lookup filter. 10 bits gives a 1% false positive rate, 0 disables the filter.\ntype:double");
+	toml.put ("ribbon_filter", ribbon_filter, "Use a ribbon filter instead of a bloom filter. Uses about 30% less memory for the same false positive rate at a higher CPU cost when building SST files.\ntype:bool");
+	toml.put ("compression", compression, "Compression of SST files, one of none, snappy, lz4 or zstd.\ntype:string");
+	toml.put ("compression_start_level", compression_start_level, "First LSM level to which compression is applied, lower levels are left uncompressed.\ntype:uint32");
+	toml.put ("prefix_length", prefix_length, "Length of the key prefix used to build prefix filters, 0 disables. For the pending table 32 groups entries by account.\ntype:uint32");
+
+	return toml.get_error ();
+}
+
+nano::error nano::rocksdb_table_config::deserialize_toml (nano::tomlconfig & toml)
+{
+	toml.get_optional<double> ("filter_bits_per_key", filter_bits_per_key);
+	toml.get_optional<bool> ("ribbon_filter", ribbon_filter);
+	toml.get_optional<std::string> ("compression", compression);
+	toml.get_optional<unsigned> ("compression_start_level", compression_start_level);
+	toml.get_optional<unsigned> ("prefix_length", prefix_length);
+
+	if (filter_bits_per_key < 0 || filter_bits_per_key > 64)
+	{
+		toml.get_error ().set ("filter_bits_per_key must be between 0 and 64");
+	}
+
+	if (compression != "none" && compression != "snappy" && compression != "lz4" && compression != "zstd")
+	{
+		toml.get_error ().set ("compression must be one of none, snappy, lz4 or zstd");
+	}
+
+	if (prefix_length > 64)
+	{
+		toml.get_error ().set ("prefix_length must be between 0 and 64");
+	}
+
+	return toml.get_error ();
+}
@@ -3,12 +3,31 @@
 #include <nano/lib/errors.hpp>
 #include <nano/lib/threading.hpp>
 
+#include <string>
 #include <thread>
 
 namespace nano
 {
 class tomlconfig;
 
+/** Per column family tuning for RocksDB tables */
+class rocksdb_table_config final
+{
+public:
+	nano::error serialize_toml (nano::tomlconfig &) const;
+	nano::error deserialize_toml (nano::tomlconfig &);
+
+	/** Bits per key of the point lookup filter, 0 disables the filter */
+	double filter_bits_per_key{ 10 };
+	/** Use a ribbon filter instead of a bloom filter, smaller for the same false positive rate but more expensive to build */
+	bool ribbon_filter{ false };
+	/** Compression used for levels starting at compression_start_level, one of: none, snappy, lz4, zstd */
+	std::string compression{ "none" };
+	unsigned compression_start_level{ 2 };
+	/** Length of the key prefix used for prefix filters, 0 disables */
+	unsigned prefix_length{ 0 };
+};
+
 /** Configuration options for RocksDB */
 class rocksdb_config final
 {
@@ -28,5 +47,17 @@ public:
 	unsigned io_threads{ std::max (nano::hardware_concurrency () / 2, 1u) };
 	long read_cache{ 32 };
 	long write_cache{ 64 };
+	/** Size of the block cache shared by all tables in megabytes, 0 gives each table its own cache of read_cache size */
+	long block_cache{ 0 };
+	/** Shared block cache implementation, one of: lru, hyper_clock */
+	std::string block_cache_type{ "lru" };
+	/** Collect RocksDB statistics and perf counters and export them through node stats */
+	bool statistics{ false };
+
+	rocksdb_table_config blocks;
+	rocksdb_table_config accounts;
+	rocksdb_table_config pending;
+	rocksdb_table_config confirmation_height;
+	rocksdb_table_config rep_weights;
 };
 }
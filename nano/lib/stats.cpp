@@ -33,7 +33,8 @@ std::string nano::stat_log_sink::tm_to_string (tm & tm)
 nano::stats::stats (nano::logger & logger_a, nano::stats_config config_a) :
 	config{ std::move (config_a) },
 	logger{ logger_a },
-	enable_logging{ is_stat_logging_enabled () }
+	enable_logging{ is_stat_logging_enabled () },
+	counters{ std::make_unique<counter_shard[]> (counter_shards) }
 {
 }
 
@@ -72,7 +73,10 @@ void nano::stats::stop ()
 void nano::stats::clear ()
 {
 	std::lock_guard guard{ mutex };
-	counters.clear ();
+	for (std::size_t shard = 0; shard < counter_shards; ++shard)
+	{
+		counters[shard].clear ();
+	}
 	samplers.clear ();
 	timestamp = std::chrono::steady_clock::now ();
 }
@@ -96,73 +100,108 @@ void nano::stats::add (stat::type type, stat::detail detail, stat::dir dir, coun
 		value);
 	}
 
-	// Updates need to happen while holding the mutex
-	auto update_counter = [this, aggregate_all] (nano::stats::counter_key key, auto && updater) {
-		counter_key all_key{ key.type, stat::detail::all, key.dir };
+	auto const index = counter_index (type, detail, dir);
+	auto & row = counters[current_shard ()].row (index / counter_row_size);
+	row.values[index % counter_row_size].fetch_add (value, std::memory_order_relaxed);
+	if (aggregate_all && detail != stat::detail::all)
+	{
+		row.values[counter_index (type, stat::detail::all, dir) % counter_row_size].fetch_add (value, std::memory_order_relaxed); // Also update the `all` counter
+	}
+}
 
-		// This is a two-step process to avoid exclusively locking the mutex in the common case
+nano::stats::counter_value_t nano::stats::count (stat::type type, stat::detail detail, stat::dir dir) const
+{
+	return counter_value (counter_index (type, detail, dir));
+}
+
+nano::stats::counter_value_t nano::stats::count (stat::type type, stat::dir dir) const
+{
+	counter_value_t result = 0;
+	for (auto detail = static_cast<std::size_t> (stat::detail::_invalid) + 1; detail < static_cast<std::size_t> (stat::detail::_last); ++detail)
+	{
+		if (static_cast<stat::detail> (detail) != stat::detail::all)
 		{
-			std::shared_lock lock{ mutex };
+			result += counter_value (counter_index (type, static_cast<stat::detail> (detail), dir));
+		}
+	}
+	return result;
+}
 
-			if (auto it = counters.find (key); it != counters.end ())
-			{
-				updater (*it->second);
+std::size_t nano::stats::counter_index (stat::type type, stat::detail detail, stat::dir dir)
+{
+	debug_assert (type < stat::type::_last && detail < stat::detail::_last && dir < stat::dir::_last);
+	auto const index = (static_cast<std::size_t> (type) * static_cast<std::size_t> (stat::detail::_last) + static_cast<std::size_t> (detail)) * static_cast<std::size_t> (stat::dir::_last) + static_cast<std::size_t> (dir);
+	debug_assert (index < counters_size);
+	return index;
+}
 
-				if (aggregate_all && key != all_key)
-				{
-					auto it_all = counters.find (all_key);
-					release_assert (it_all != counters.end ()); // The `all` counter should always be created together
-					updater (*it_all->second); // Also update the `all` counter
-				}
+std::size_t nano::stats::current_shard ()
+{
+	// Threads are assigned shards round robin the first time they update a counter
+	static std::atomic<std::size_t> next_shard{ 0 };
+	thread_local std::size_t const shard = next_shard.fetch_add (1, std::memory_order_relaxed) % counter_shards;
+	return shard;
+}
 
-				return;
-			}
-		}
-		// Not found, create a new entry
+auto nano::stats::counter_value (std::size_t index) const -> counter_value_t
+{
+	counter_value_t result = 0;
+	for (std::size_t shard = 0; shard < counter_shards; ++shard)
+	{
+		if (auto row = counters[shard].find (index / counter_row_size))
 		{
-			std::unique_lock lock{ mutex };
-
-			// Insertions will be ignored if the key already exists
-			auto [it, inserted] = counters.emplace (key, std::make_unique<counter_entry> ());
-			updater (*it->second);
-
-			if (aggregate_all && key != all_key)
-			{
-				auto [it_all, inserted_all] = counters.emplace (all_key, std::make_unique<counter_entry> ());
-				updater (*it_all->second); // Also update the `all` counter
-			}
+			result += row->values[index % counter_row_size].load (std::memory_order_relaxed);
 		}
-	};
+	}
+	return result;
+}
 
-	update_counter (counter_key{ type, detail, dir }, [value] (counter_entry & counter) {
-		counter.value += value;
-	});
+/*
+ * stats::counter_shard
+ */
+
+nano::stats::counter_shard::~counter_shard ()
+{
+	for (auto & row : rows)
+	{
+		delete row.load ();
+	}
 }
 
-nano::stats::counter_value_t nano::stats::count (stat::type type, stat::detail detail, stat::dir dir) const
+auto nano::stats::counter_shard::row (std::size_t type) -> counter_row &
 {
-	std::shared_lock lock{ mutex };
-	if (auto it = counters.find (counter_key{ type, detail, dir }); it != counters.end ())
+	debug_assert (type < counter_types);
+	auto existing = rows[type].load (std::memory_order_acquire);
+	if (!existing)
 	{
-		return it->second->value;
+		// Threads sharing the shard may race to create the row, the one that loses frees its copy
+		auto created = std::make_unique<counter_row> ();
+		if (rows[type].compare_exchange_strong (existing, created.get (), std::memory_order_acq_rel))
+		{
+			existing = created.release ();
+		}
 	}
-	return 0;
+	return *existing;
 }
 
-nano::stats::counter_value_t nano::stats::count (stat::type type, stat::dir dir) const
+auto nano::stats::counter_shard::find (std::size_t type) const -> counter_row const *
 {
-	std::shared_lock lock{ mutex };
-	counter_value_t result = 0;
-	auto it = counters.lower_bound (counter_key{ type, stat::detail::all, dir });
-	while (it != counters.end () && it->first.type == type)
+	debug_assert (type < counter_types);
+	return rows[type].load (std::memory_order_acquire);
+}
+
+void nano::stats::counter_shard::clear ()
+{
+	for (auto & row : rows)
 	{
-		if (it->first.dir == dir && it->first.detail != stat::detail::all)
+		if (auto existing = row.load (std::memory_order_acquire))
 		{
-			result += it->second->value;
+			for (auto & value : existing->values)
+			{
+				value.store (0, std::memory_order_relaxed);
+			}
 		}
-		++it;
 	}
-	return result;
 }
 
 void nano::stats::sample (stat::sample sample, nano::stats::sampler_value_t value, std::pair<sampler_value_t, sampler_value_t> expected_min_max)
@@ -236,13 +275,24 @@ void nano::stats::log_counters_impl (stat_log_sink & sink, tm & tm)
 		sink.write_header ("counters", walltime);
 	}
 
-	for (auto const & [key, entry] : counters)
+	// Table order matches the (type, detail, dir) ordering, only counters that were updated are written
+	for (std::size_t index = 0; index < counters_size; ++index)
 	{
-		std::string type{ to_string (key.type) };
-		std::string detail{ to_string (key.detail) };
-		std::string dir{ to_string (key.dir) };
+		auto value = counter_value (index);
+		if (value == 0)
+		{
+			continue;
+		}
+
+		auto const dir_index = index % static_cast<std::size_t> (stat::dir::_last);
+		auto const detail_index = (index / static_cast<std::size_t> (stat::dir::_last)) % static_cast<std::size_t> (stat::detail::_last);
+		auto const type_index = index / static_cast<std::size_t> (stat::dir::_last) / static_cast<std::size_t> (stat::detail::_last);
+
+		std::string type{ to_string (static_cast<stat::type> (type_index)) };
+		std::string detail{ to_string (static_cast<stat::detail> (detail_index)) };
+		std::string dir{ to_string (static_cast<stat::dir> (dir_index)) };
 
-		sink.write_counter_entry (tm, type, detail, dir, entry->value);
+		sink.write_counter_entry (tm, type, detail, dir, value);
 	}
 	sink.entries ()++;
 	sink.finalize ();
@@ -7,6 +7,8 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <initializer_list>
 #include <map>
@@ -132,15 +134,6 @@ public:
 	std::string dump (category category = category::counters);
 
 private:
-	struct counter_key
-	{
-		stat::type type;
-		stat::detail detail;
-		stat::dir dir;
-
-		auto operator<=> (const counter_key &) const = default;
-	};
-
 	struct sampler_key
 	{
 		stat::sample sample;
@@ -149,18 +142,44 @@ private:
 	};
 
 private:
-	class counter_entry
+	static constexpr std::size_t counter_types = static_cast<std::size_t> (stat::type::_last);
+	/** Number of counters per type, one for every detail/dir combination */
+	static constexpr std::size_t counter_row_size = static_cast<std::size_t> (stat::detail::_last) * static_cast<std::size_t> (stat::dir::_last);
+	static constexpr std::size_t counters_size = counter_types * counter_row_size;
+
+	/** Number of copies of the counter table, threads are spread over them so concurrent increments of a counter do not contend for the same cache line */
+	static constexpr std::size_t counter_shards = 8;
+
+	class counter_row
 	{
 	public:
-		// Prevent copying
-		counter_entry () = default;
-		counter_entry (counter_entry const &) = delete;
-		counter_entry & operator= (counter_entry const &) = delete;
+		std::array<std::atomic<counter_value_t>, counter_row_size> values{};
+	};
 
+	/**
+	 * Dense table with a slot for every type/detail/dir combination, the value of a counter is the sum of its slots across all shards
+	 * Rows are allocated the first time a thread of the shard updates a counter of that type, so memory grows with the types actually in use
+	 */
+	class alignas (64) counter_shard
+	{
 	public:
-		std::atomic<counter_value_t> value{ 0 };
+		~counter_shard ();
+
+		/** Row for the type, created if missing */
+		counter_row & row (std::size_t type);
+		/** Row for the type, null if no counter of that type was updated in this shard */
+		counter_row const * find (std::size_t type) const;
+		void clear ();
+
+	private:
+		// Published with a compare exchange so updates never take a lock, owned by the shard
+		std::array<std::atomic<counter_row *>, counter_types> rows{};
 	};
 
+	static std::size_t counter_index (stat::type, stat::detail, stat::dir);
+	static std::size_t current_shard ();
+	counter_value_t counter_value (std::size_t index) const;
+
 	class sampler_entry
 	{
 	public:
@@ -183,9 +202,10 @@ private:
 		mutable nano::mutex mutex;
 	};
 
+	// Counters are updated without locking, the mutex only guards samplers and logging
+	std::unique_ptr<counter_shard[]> counters;
+
 	// Wrap in unique_ptrs because mutex/atomic members are not movable
-	// TODO: Compare performance of map vs unordered_map
-	std::map<counter_key, std::unique_ptr<counter_entry>> counters;
 	std::map<sampler_key, std::unique_ptr<sampler_entry>> samplers;
 
 private:
@@ -93,6 +93,9 @@ enum class type
 	message_processor,
 	message_processor_overfill,
 	message_processor_type,
+	rocksdb,
+	rocksdb_perf,
+	lmdb,
 
 	_last // Must be the last enum
 };
@@ -173,11 +176,16 @@ enum class detail
 	balance_mismatch,
 	representative_mismatch,
 	block_position,
+	cache_snapshot_loaded,
+	cache_snapshot_invalid,
+	cache_snapshot_saved,
 
 	// blockprocessor
 	process_blocking,
 	process_blocking_timeout,
 	force,
+	signatures_verified,
+	precheck_existing,
 
 	// block source
 	live,
@@ -290,6 +298,7 @@ enum class detail
 	tcp_connect_error,
 	tcp_read_error,
 	tcp_write_error,
+	tcp_write_batch,
 
 	// tcp_listener
 	accept_success,
@@ -397,6 +406,9 @@ enum class detail
 	activate_failed,
 	activate_skip,
 	activate_full,
+	full_scan,
+	index_scan,
+	index_erased,
 
 	// active
 	insert,
@@ -498,6 +510,8 @@ enum class detail
 	already_cemented,
 	cementing,
 	cemented_hash,
+	planned,
+	plan_fallback,
 
 	// election_state
 	passive,
@@ -521,6 +535,32 @@ enum class detail
 	blocks_by_account,
 	account_info_by_hash,
 
+	// rocksdb
+	block_cache_hit,
+	block_cache_miss,
+	bloom_filter_useful,
+	bloom_filter_full_positive,
+	bloom_filter_prefix_useful,
+	memtable_hit,
+	memtable_miss,
+	get_hit_l0,
+	get_hit_l1,
+	get_hit_l2_and_up,
+	bytes_read,
+	bytes_written,
+	compact_read_bytes,
+	compact_write_bytes,
+
+	// rocksdb_perf
+	memtable_get,
+	block_read,
+	block_read_bytes,
+	bloom_sst_hit,
+	bloom_sst_miss,
+
+	// lmdb
+	sync_failed,
+
 	_last // Must be the last enum
 };
 
@@ -17,6 +17,7 @@ enum class name
 	vote_processing,
 	vote_cache_processing,
 	block_processing,
+	block_processing_workers,
 	request_loop,
 	wallet_actions,
 	bootstrap_initiator,
@@ -27,6 +28,7 @@ enum class name
 	rpc_process_container,
 	confirmation_height,
 	confirmation_height_notifications,
+	confirmation_height_planning,
 	worker,
 	bootstrap_worker,
 	wallet_worker,
@@ -60,6 +62,7 @@ enum class name
 	stats,
 	vote_router,
 	monitor,
+	lmdb_sync,
 };
 
 std::string_view to_string (name);
@@ -1,4 +1,3 @@
-#include <nano/crypto/blake2/blake2.h>
 #include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/epoch.hpp>
@@ -7,6 +6,7 @@
 #include <nano/lib/work.hpp>
 #include <nano/node/xorshift.hpp>
 
+#include <array>
 #include <future>
 
 std::string nano::to_string (nano::work_version const version_a)
@@ -65,8 +65,9 @@ void nano::work_pool::loop (uint64_t thread)
 	nano::random_pool::generate_block (reinterpret_cast<uint8_t *> (rng.s.data ()), rng.s.size () * sizeof (decltype (rng.s)::value_type));
 	uint64_t work;
 	uint64_t output;
-	blake2b_state hash;
-	blake2b_init (&hash, sizeof (output));
+	auto const lanes = nano::work_hash::lanes (engine);
+	std::array<uint64_t, nano::work_hash::max_lanes> nonces;
+	std::array<uint64_t, nano::work_hash::max_lanes> outputs;
 	nano::unique_lock<nano::mutex> lock{ mutex };
 	auto pow_sleep = pow_rate_limiter;
 	while (!done)
@@ -101,14 +102,21 @@ void nano::work_pool::loop (uint64_t thread)
 					// Don't query main memory every iteration in order to reduce memory bus traffic
 					// All operations here operate on stack memory
 					// Count iterations down to zero since comparing to zero is easier than comparing to another number
-					unsigned iteration (256);
+					// Each iteration hashes one nonce per SIMD lane
+					unsigned iteration (256 / lanes);
 					while (iteration && output < current_l.difficulty)
 					{
-						work = rng.next ();
-						blake2b_update (&hash, reinterpret_cast<uint8_t *> (&work), sizeof (work));
-						blake2b_update (&hash, current_l.item.bytes.data (), current_l.item.bytes.size ());
-						blake2b_final (&hash, reinterpret_cast<uint8_t *> (&output), sizeof (output));
-						blake2b_init (&hash, sizeof (output));
+						for (std::size_t lane = 0; lane < lanes; ++lane)
+						{
+							nonces[lane] = rng.next ();
+						}
+						nano::work_hash::values (engine, current_l.item, nonces.data (), outputs.data (), lanes);
+						// Stops at the first lane meeting the difficulty, otherwise leaves the last lane which is below it
+						for (std::size_t lane = 0; lane < lanes && output < current_l.difficulty; ++lane)
+						{
+							work = nonces[lane];
+							output = outputs[lane];
+						}
 						iteration -= 1;
 					}
 
@@ -5,6 +5,7 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/observer_set.hpp>
 #include <nano/lib/utility.hpp>
+#include <nano/lib/work_hash.hpp>
 #include <nano/node/openclwork.hpp>
 
 #include <boost/optional.hpp>
@@ -61,6 +62,8 @@ public:
 	std::chrono::nanoseconds pow_rate_limiter;
 	nano::opencl_work_func_t opencl;
 	nano::observer_set<bool> work_observers;
+	// CPU work is hashed with the widest SIMD engine available
+	nano::work_hash::engine const engine{ nano::work_hash::best () };
 
 	nano::container_info container_info () const;
 };
@@ -0,0 +1,193 @@
+#define NANO_WORK_HASH_TARGET
+#include <nano/lib/utility.hpp>
+#include <nano/lib/work_hash.hpp>
+#include <nano/lib/work_hash_impl.hpp>
+
+#include <bit>
+
+#if defined(NANO_WORK_HASH_X86) && defined(_MSC_VER) && !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace
+{
+class scalar_ops
+{
+public:
+	using vector = uint64_t;
+	static std::size_t constexpr lanes = 1;
+
+	static vector set1 (uint64_t value)
+	{
+		return value;
+	}
+	static vector load (uint64_t const * source)
+	{
+		return *source;
+	}
+	static void store (uint64_t * destination, vector value)
+	{
+		*destination = value;
+	}
+	static vector add (vector a, vector b)
+	{
+		return a + b;
+	}
+	static vector xor_ (vector a, vector b)
+	{
+		return a ^ b;
+	}
+	static vector rotr32 (vector value)
+	{
+		return std::rotr (value, 32);
+	}
+	static vector rotr24 (vector value)
+	{
+		return std::rotr (value, 24);
+	}
+	static vector rotr16 (vector value)
+	{
+		return std::rotr (value, 16);
+	}
+	static vector rotr63 (vector value)
+	{
+		return std::rotr (value, 63);
+	}
+};
+
+bool cpu_supports (nano::work_hash::engine engine)
+{
+#if defined(NANO_WORK_HASH_X86) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init ();
+	switch (engine)
+	{
+		case nano::work_hash::engine::scalar:
+			return true;
+		case nano::work_hash::engine::avx2:
+			return __builtin_cpu_supports ("avx2");
+		case nano::work_hash::engine::avx512:
+			return __builtin_cpu_supports ("avx512f");
+	}
+	return false;
+#elif defined(NANO_WORK_HASH_X86) && defined(_MSC_VER)
+	if (engine == nano::work_hash::engine::scalar)
+	{
+		return true;
+	}
+	int registers[4];
+	__cpuid (registers, 1);
+	bool const osxsave = (registers[2] & (1 << 27)) != 0;
+	bool const avx = (registers[2] & (1 << 28)) != 0;
+	if (!osxsave || !avx)
+	{
+		return false;
+	}
+	// Operating system must save the extended register state on context switches
+	auto const xcr0 = _xgetbv (0);
+	__cpuidex (registers, 7, 0);
+	switch (engine)
+	{
+		case nano::work_hash::engine::avx2:
+			return (xcr0 & 0x6) == 0x6 && (registers[1] & (1 << 5)) != 0;
+		case nano::work_hash::engine::avx512:
+			return (xcr0 & 0xe6) == 0xe6 && (registers[1] & (1 << 16)) != 0;
+		default:
+			return false;
+	}
+#else
+	return engine == nano::work_hash::engine::scalar;
+#endif
+}
+
+void dispatch (nano::work_hash::engine engine, nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	debug_assert (nano::work_hash::supported (engine));
+	switch (engine)
+	{
+#ifdef NANO_WORK_HASH_X86
+		case nano::work_hash::engine::avx2:
+			nano::work_hash::detail::values_avx2 (roots, root_stride, nonces, outputs, count);
+			return;
+		case nano::work_hash::engine::avx512:
+			nano::work_hash::detail::values_avx512 (roots, root_stride, nonces, outputs, count);
+			return;
+#endif
+		default:
+			nano::work_hash::detail::values_scalar (roots, root_stride, nonces, outputs, count);
+			return;
+	}
+}
+}
+
+void nano::work_hash::detail::values_scalar (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	values<scalar_ops> (roots, root_stride, nonces, outputs, count);
+}
+
+std::string_view nano::work_hash::to_string (engine engine_a)
+{
+	switch (engine_a)
+	{
+		case engine::scalar:
+			return "scalar";
+		case engine::avx2:
+			return "avx2";
+		case engine::avx512:
+			return "avx512";
+	}
+	return "unknown";
+}
+
+bool nano::work_hash::supported (engine engine_a)
+{
+	static bool const avx2 = cpu_supports (engine::avx2);
+	static bool const avx512 = cpu_supports (engine::avx512);
+	switch (engine_a)
+	{
+		case engine::scalar:
+			return true;
+		case engine::avx2:
+			return avx2;
+		case engine::avx512:
+			return avx512;
+	}
+	return false;
+}
+
+nano::work_hash::engine nano::work_hash::best ()
+{
+	if (supported (engine::avx512))
+	{
+		return engine::avx512;
+	}
+	if (supported (engine::avx2))
+	{
+		return engine::avx2;
+	}
+	return engine::scalar;
+}
+
+std::size_t nano::work_hash::lanes (engine engine_a)
+{
+	switch (engine_a)
+	{
+		case engine::scalar:
+			return 1;
+		case engine::avx2:
+			return 4;
+		case engine::avx512:
+			return 8;
+	}
+	return 1;
+}
+
+void nano::work_hash::values (engine engine_a, nano::root const * roots, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	dispatch (engine_a, roots, 1, nonces, outputs, count);
+}
+
+void nano::work_hash::values (engine engine_a, nano::root const & root, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	dispatch (engine_a, &root, 0, nonces, outputs, count);
+}
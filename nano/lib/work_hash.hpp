@@ -0,0 +1,36 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Multi-lane blake2b used for proof of work
+ * Work values are 8 byte blake2b digests of an 8 byte nonce followed by a 32 byte root, the input always fits a single compression block
+ * which allows hashing several nonces at once with each SIMD lane holding an independent blake2b state
+ */
+namespace nano::work_hash
+{
+enum class engine
+{
+	scalar,
+	avx2, // 4 lanes
+	avx512, // 8 lanes
+};
+
+std::string_view to_string (engine);
+
+/** Widest engine supported by both the build and the CPU, detected once via CPUID */
+engine best ();
+bool supported (engine);
+/** Number of nonces hashed per iteration */
+std::size_t lanes (engine);
+std::size_t constexpr max_lanes = 8;
+
+/** Computes outputs[i] = work value of (roots[i], nonces[i]) */
+void values (engine, nano::root const * roots, uint64_t const * nonces, uint64_t * outputs, std::size_t count);
+/** Computes outputs[i] = work value of (root, nonces[i]) */
+void values (engine, nano::root const & root, uint64_t const * nonces, uint64_t * outputs, std::size_t count);
+}
@@ -0,0 +1,66 @@
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NANO_WORK_HASH_TARGET
+#else
+#define NANO_WORK_HASH_TARGET __attribute__ ((target ("avx2")))
+#endif
+#include <nano/lib/work_hash_impl.hpp>
+
+#ifdef NANO_WORK_HASH_X86
+
+#include <immintrin.h>
+
+namespace
+{
+class avx2_ops
+{
+public:
+	using vector = __m256i;
+	static std::size_t constexpr lanes = 4;
+
+	static NANO_WORK_HASH_TARGET vector set1 (uint64_t value)
+	{
+		return _mm256_set1_epi64x (static_cast<long long> (value));
+	}
+	static NANO_WORK_HASH_TARGET vector load (uint64_t const * source)
+	{
+		return _mm256_load_si256 (reinterpret_cast<__m256i const *> (source));
+	}
+	static NANO_WORK_HASH_TARGET void store (uint64_t * destination, vector value)
+	{
+		_mm256_store_si256 (reinterpret_cast<__m256i *> (destination), value);
+	}
+	static NANO_WORK_HASH_TARGET vector add (vector a, vector b)
+	{
+		return _mm256_add_epi64 (a, b);
+	}
+	static NANO_WORK_HASH_TARGET vector xor_ (vector a, vector b)
+	{
+		return _mm256_xor_si256 (a, b);
+	}
+	static NANO_WORK_HASH_TARGET vector rotr32 (vector value)
+	{
+		return _mm256_shuffle_epi32 (value, _MM_SHUFFLE (2, 3, 0, 1));
+	}
+	static NANO_WORK_HASH_TARGET vector rotr24 (vector value)
+	{
+		auto const mask = _mm256_setr_epi8 (3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+		return _mm256_shuffle_epi8 (value, mask);
+	}
+	static NANO_WORK_HASH_TARGET vector rotr16 (vector value)
+	{
+		auto const mask = _mm256_setr_epi8 (2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+		return _mm256_shuffle_epi8 (value, mask);
+	}
+	static NANO_WORK_HASH_TARGET vector rotr63 (vector value)
+	{
+		return _mm256_or_si256 (_mm256_srli_epi64 (value, 63), _mm256_add_epi64 (value, value));
+	}
+};
+}
+
+void nano::work_hash::detail::values_avx2 (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	values<avx2_ops> (roots, root_stride, nonces, outputs, count);
+}
+
+#endif
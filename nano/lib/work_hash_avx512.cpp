@@ -0,0 +1,65 @@
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NANO_WORK_HASH_TARGET
+#else
+#define NANO_WORK_HASH_TARGET __attribute__ ((target ("avx512f")))
+#endif
+#include <nano/lib/work_hash_impl.hpp>
+
+#ifdef NANO_WORK_HASH_X86
+
+#include <immintrin.h>
+
+namespace
+{
+class avx512_ops
+{
+public:
+	using vector = __m512i;
+	static std::size_t constexpr lanes = 8;
+
+	static NANO_WORK_HASH_TARGET vector set1 (uint64_t value)
+	{
+		return _mm512_set1_epi64 (static_cast<long long> (value));
+	}
+	static NANO_WORK_HASH_TARGET vector load (uint64_t const * source)
+	{
+		return _mm512_load_si512 (source);
+	}
+	static NANO_WORK_HASH_TARGET void store (uint64_t * destination, vector value)
+	{
+		_mm512_store_si512 (destination, value);
+	}
+	static NANO_WORK_HASH_TARGET vector add (vector a, vector b)
+	{
+		return _mm512_add_epi64 (a, b);
+	}
+	static NANO_WORK_HASH_TARGET vector xor_ (vector a, vector b)
+	{
+		return _mm512_xor_si512 (a, b);
+	}
+	// Full mask zeroing rotates, the unmasked intrinsic trips -Wmaybe-uninitialized in some GCC versions
+	static NANO_WORK_HASH_TARGET vector rotr32 (vector value)
+	{
+		return _mm512_maskz_ror_epi64 (0xff, value, 32);
+	}
+	static NANO_WORK_HASH_TARGET vector rotr24 (vector value)
+	{
+		return _mm512_maskz_ror_epi64 (0xff, value, 24);
+	}
+	static NANO_WORK_HASH_TARGET vector rotr16 (vector value)
+	{
+		return _mm512_maskz_ror_epi64 (0xff, value, 16);
+	}
+	static NANO_WORK_HASH_TARGET vector rotr63 (vector value)
+	{
+		return _mm512_maskz_ror_epi64 (0xff, value, 63);
+	}
+};
+}
+
+void nano::work_hash::detail::values_avx512 (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	values<avx512_ops> (roots, root_stride, nonces, outputs, count);
+}
+
+#endif
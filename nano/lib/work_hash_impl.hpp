@@ -0,0 +1,170 @@
+#pragma once
+
+#include <nano/lib/numbers.hpp>
+
+#include <boost/endian/conversion.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Shared blake2b kernel for work_hash engines, only to be included by work_hash*.cpp
+ * Each engine translation unit defines NANO_WORK_HASH_TARGET with the instruction set its kernel is compiled for and instantiates
+ * the kernel with its own lane operations, defined in an anonymous namespace so instantiations never get merged by the linker
+ */
+#ifndef NANO_WORK_HASH_TARGET
+#error "NANO_WORK_HASH_TARGET must be defined before including work_hash_impl.hpp"
+#endif
+
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define NANO_WORK_HASH_X86 1
+#endif
+
+namespace nano::work_hash::detail
+{
+void values_scalar (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count);
+#ifdef NANO_WORK_HASH_X86
+void values_avx2 (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count);
+void values_avx512 (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count);
+#endif
+
+using root_words = std::array<uint64_t, 4>;
+
+inline constexpr std::array<uint64_t, 8> iv = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+	0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+inline constexpr uint8_t sigma[12][16] = {
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 },
+	{ 11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4 },
+	{ 7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8 },
+	{ 9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13 },
+	{ 2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9 },
+	{ 12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11 },
+	{ 13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10 },
+	{ 6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5 },
+	{ 10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3 }
+};
+
+// Parameter block for an unkeyed 8 byte digest: digest_length = 8, fanout = 1, depth = 1
+inline constexpr uint64_t h0 = iv[0] ^ 0x01010008ULL;
+// Input length, nonce followed by root
+inline constexpr uint64_t input_size = sizeof (uint64_t) + sizeof (nano::root);
+
+static inline root_words load_root (nano::root const & root)
+{
+	root_words result;
+	std::memcpy (result.data (), root.bytes.data (), sizeof (result));
+	for (auto & word : result)
+	{
+		boost::endian::little_to_native_inplace (word);
+	}
+	return result;
+}
+
+template <typename Ops>
+NANO_WORK_HASH_TARGET inline void mix (typename Ops::vector (&v)[16], int a, int b, int c, int d, typename Ops::vector const & x, typename Ops::vector const & y)
+{
+	v[a] = Ops::add (Ops::add (v[a], v[b]), x);
+	v[d] = Ops::rotr32 (Ops::xor_ (v[d], v[a]));
+	v[c] = Ops::add (v[c], v[d]);
+	v[b] = Ops::rotr24 (Ops::xor_ (v[b], v[c]));
+	v[a] = Ops::add (Ops::add (v[a], v[b]), y);
+	v[d] = Ops::rotr16 (Ops::xor_ (v[d], v[a]));
+	v[c] = Ops::add (v[c], v[d]);
+	v[b] = Ops::rotr63 (Ops::xor_ (v[b], v[c]));
+}
+
+/**
+ * Single block blake2b compression of (nonce, root) for every lane of Ops::vector
+ */
+template <typename Ops>
+NANO_WORK_HASH_TARGET inline typename Ops::vector compress (typename Ops::vector nonce, typename Ops::vector const (&root)[4])
+{
+	using vector = typename Ops::vector;
+
+	vector const zero = Ops::set1 (0);
+	vector const m[16] = { nonce, root[0], root[1], root[2], root[3], zero, zero, zero, zero, zero, zero, zero, zero, zero, zero, zero };
+
+	vector v[16] = {
+		Ops::set1 (h0), Ops::set1 (iv[1]), Ops::set1 (iv[2]), Ops::set1 (iv[3]),
+		Ops::set1 (iv[4]), Ops::set1 (iv[5]), Ops::set1 (iv[6]), Ops::set1 (iv[7]),
+		Ops::set1 (iv[0]), Ops::set1 (iv[1]), Ops::set1 (iv[2]), Ops::set1 (iv[3]),
+		Ops::set1 (iv[4] ^ input_size), Ops::set1 (iv[5]), Ops::set1 (~iv[6]), Ops::set1 (iv[7])
+	};
+
+	for (auto const & s : sigma)
+	{
+		mix<Ops> (v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+		mix<Ops> (v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+		mix<Ops> (v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+		mix<Ops> (v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+		mix<Ops> (v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+		mix<Ops> (v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+		mix<Ops> (v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+		mix<Ops> (v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+	}
+
+	return Ops::xor_ (Ops::xor_ (Ops::set1 (h0), v[0]), v[8]);
+}
+
+/**
+ * Hashes count nonces, Ops::lanes at a time. A root_stride of 0 uses roots[0] for every nonce
+ * Remaining nonces which do not fill a vector are padded
+ */
+template <typename Ops>
+NANO_WORK_HASH_TARGET inline void values (nano::root const * roots, std::size_t root_stride, uint64_t const * nonces, uint64_t * outputs, std::size_t count)
+{
+	constexpr std::size_t lanes = Ops::lanes;
+	using vector = typename Ops::vector;
+
+	vector shared_root[4] = { Ops::set1 (0), Ops::set1 (0), Ops::set1 (0), Ops::set1 (0) };
+	if (root_stride == 0 && count > 0)
+	{
+		auto const words = load_root (roots[0]);
+		for (std::size_t i = 0; i < words.size (); ++i)
+		{
+			shared_root[i] = Ops::set1 (words[i]);
+		}
+	}
+
+	for (std::size_t offset = 0; offset < count; offset += lanes)
+	{
+		auto const batch = count - offset < lanes ? count - offset : lanes;
+
+		alignas (64) uint64_t nonce_l[lanes] = {};
+		alignas (64) uint64_t root_l[4][lanes] = {};
+		for (std::size_t lane = 0; lane < batch; ++lane)
+		{
+			nonce_l[lane] = boost::endian::little_to_native (nonces[offset + lane]);
+			if (root_stride != 0)
+			{
+				auto const words = load_root (roots[(offset + lane) * root_stride]);
+				for (std::size_t i = 0; i < words.size (); ++i)
+				{
+					root_l[i][lane] = words[i];
+				}
+			}
+		}
+
+		vector root_v[4];
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			root_v[i] = root_stride != 0 ? Ops::load (root_l[i]) : shared_root[i];
+		}
+
+		alignas (64) uint64_t output_l[lanes];
+		Ops::store (output_l, compress<Ops> (Ops::load (nonce_l), root_v));
+		for (std::size_t lane = 0; lane < batch; ++lane)
+		{
+			outputs[offset + lane] = boost::endian::little_to_native (output_l[lane]);
+		}
+	}
+}
+}
@@ -15,7 +15,9 @@
 #include <nano/node/transport/inproc.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
+#include <nano/secure/parallel_traversal.hpp>
 #include <nano/store/pending.hpp>
+#include <nano/store/value_view.hpp>
 
 #include <boost/dll/runtime_symbol_info.hpp>
 #include <boost/format.hpp>
@@ -1939,80 +1941,64 @@ int main (int argc, char * const * argv)
 			auto node = inactive_node->node;
 			auto const epoch_count = nano::normalized_epoch (nano::epoch::max) + static_cast<std::underlying_type<nano::epoch>::type> (1);
 			// Cache the accounts in a collection to make searching quicker against unchecked keys. Group by epoch
-			nano::locked<std::vector<boost::unordered_set<nano::account>>> opened_account_versions_shared (epoch_count);
-			using opened_account_versions_t = decltype (opened_account_versions_shared)::value_type;
-			node->store.account.for_each_par (
-			[&opened_account_versions_shared, epoch_count] (nano::store::read_transaction const & /*unused*/, nano::store::iterator<nano::account, nano::account_info> i, nano::store::iterator<nano::account, nano::account_info> n) {
-				// First cache locally
+			// Each account range is scanned on the traversal pool and its results are merged in key order
+			using opened_account_versions_t = std::vector<std::vector<nano::account>>;
+			auto opened_ranges = parallel_traversal<nano::uint256_t> (node->traversal_workers, 0, [&node, epoch_count] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
 				opened_account_versions_t opened_account_versions_l (epoch_count);
-				for (; i != n; ++i)
+				auto transaction = node->store.tx_begin_read ();
+				for (auto i = node->store.account.begin (transaction, begin), n = !is_last ? node->store.account.begin (transaction, end) : node->store.account.end (); i != n; ++i)
 				{
-					auto const & account (i->first);
-					auto const & account_info (i->second);
-
 					// Epoch 0 will be index 0 for instance
-					auto epoch_idx = nano::normalized_epoch (account_info.epoch ());
-					opened_account_versions_l[epoch_idx].emplace (account);
-				}
-				// Now merge
-				auto opened_account_versions = opened_account_versions_shared.lock ();
-				debug_assert (opened_account_versions->size () == opened_account_versions_l.size ());
-				for (auto idx (0); idx < opened_account_versions_l.size (); ++idx)
-				{
-					auto & accounts = opened_account_versions->at (idx);
-					auto const & accounts_l = opened_account_versions_l.at (idx);
-					accounts.insert (accounts_l.begin (), accounts_l.end ());
+					auto epoch_idx = nano::normalized_epoch (i.value_view<nano::store::account_info_view> ().epoch ());
+					opened_account_versions_l[epoch_idx].push_back (i->first);
 				}
+				return opened_account_versions_l;
 			});
 
+			opened_account_versions_t opened_account_versions (epoch_count);
 			// Caching in a single set speeds up lookup
 			boost::unordered_set<nano::account> opened_accounts;
+			for (auto const & opened_account_versions_l : opened_ranges)
 			{
-				auto opened_account_versions = opened_account_versions_shared.lock ();
-				for (auto const & account_version : *opened_account_versions)
+				for (auto idx = 0u; idx < opened_account_versions_l.size (); ++idx)
 				{
-					opened_accounts.insert (account_version.cbegin (), account_version.cend ());
+					auto const & accounts_l = opened_account_versions_l[idx];
+					opened_account_versions[idx].insert (opened_account_versions[idx].end (), accounts_l.begin (), accounts_l.end ());
+					opened_accounts.insert (accounts_l.begin (), accounts_l.end ());
 				}
 			}
 
-			// Iterate all pending blocks and collect the lowest version for each unopened account
-			nano::locked<boost::unordered_map<nano::account, std::underlying_type_t<nano::epoch>>> unopened_highest_pending_shared;
-			using unopened_highest_pending_t = decltype (unopened_highest_pending_shared)::value_type;
-			node->store.pending.for_each_par (
-			[&unopened_highest_pending_shared, &opened_accounts] (nano::store::read_transaction const & /*unused*/, nano::store::iterator<nano::pending_key, nano::pending_info> i, nano::store::iterator<nano::pending_key, nano::pending_info> n) {
-				// First cache locally
+			// Iterate all pending blocks and collect the highest version for each unopened account
+			// Ranges split the account space, so every unopened account is only seen by a single range
+			using unopened_highest_pending_t = std::vector<std::pair<nano::account, std::underlying_type_t<nano::epoch>>>;
+			auto pending_ranges = parallel_traversal<nano::uint256_t> (node->traversal_workers, 0, [&node, &opened_accounts] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
 				unopened_highest_pending_t unopened_highest_pending_l;
-				for (; i != n; ++i)
+				auto transaction = node->store.tx_begin_read ();
+				for (auto i = node->store.pending.begin (transaction, nano::pending_key (begin, 0)), n = !is_last ? node->store.pending.begin (transaction, nano::pending_key (end, 0)) : node->store.pending.end (); i != n; ++i)
 				{
-					nano::pending_key const & key (i->first);
-					nano::pending_info const & info (i->second);
-					auto & account = key.account;
+					auto const account = i.key_view<nano::store::pending_key_view> ().account ();
 					auto exists = opened_accounts.find (account) != opened_accounts.end ();
 					if (!exists)
 					{
-						// This is an unopened account, store the lowest pending version
-						auto epoch = nano::normalized_epoch (info.epoch);
-						auto & existing_or_new = unopened_highest_pending_l[key.account];
-						existing_or_new = std::max (epoch, existing_or_new);
+						// This is an unopened account, store the highest pending version
+						auto epoch = nano::normalized_epoch (i.value_view<nano::store::pending_info_view> ().epoch ());
+						if (unopened_highest_pending_l.empty () || unopened_highest_pending_l.back ().first != account)
+						{
+							unopened_highest_pending_l.emplace_back (account, epoch);
+						}
+						else
+						{
+							unopened_highest_pending_l.back ().second = std::max (epoch, unopened_highest_pending_l.back ().second);
+						}
 					}
 				}
-				// Now merge
-				auto unopened_highest_pending = unopened_highest_pending_shared.lock ();
-				for (auto const & [account, epoch] : unopened_highest_pending_l)
-				{
-					auto & existing_or_new = unopened_highest_pending->operator[] (account);
-					existing_or_new = std::max (epoch, existing_or_new);
-				}
+				return unopened_highest_pending_l;
 			});
 
 			auto output_account_version_number = [] (auto version, auto num_accounts) {
 				std::cout << "Account version " << version << " num accounts: " << num_accounts << "\n";
 			};
 
-			// Only single-threaded access from now on
-			auto const & opened_account_versions = *opened_account_versions_shared.lock ();
-			auto const & unopened_highest_pending = *unopened_highest_pending_shared.lock ();
-
 			// Output total version counts for the opened accounts
 			std::cout << "Opened accounts:\n";
 			for (auto i = 0u; i < opened_account_versions.size (); ++i)
@@ -2022,9 +2008,12 @@ int main (int argc, char * const * argv)
 
 			// Accumulate the version numbers for the highest pending epoch for each unopened account.
 			std::vector<size_t> unopened_account_version_totals (epoch_count);
-			for (auto const & [account, epoch] : unopened_highest_pending)
+			for (auto const & unopened_highest_pending : pending_ranges)
 			{
-				++unopened_account_version_totals[epoch];
+				for (auto const & [account, epoch] : unopened_highest_pending)
+				{
+					++unopened_account_version_totals[epoch];
+				}
 			}
 
 			// Output total version counts for the unopened accounts
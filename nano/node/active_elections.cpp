@@ -15,6 +15,7 @@
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/store/component.hpp>
 
+#include <algorithm>
 #include <ranges>
 
 using namespace std::chrono;
@@ -28,8 +29,6 @@ nano::active_elections::active_elections (nano::node & node_a, nano::confirming_
 	recently_cemented{ config.confirmation_history_size },
 	election_time_to_live{ node_a.network_params.network.is_dev_network () ? 0s : 2s }
 {
-	count_by_behavior.fill (0); // Zero initialize array
-
 	confirming_set.batch_cemented.add ([this] (nano::confirming_set::cemented_notification const & notification) {
 		{
 			auto transaction = node.ledger.tx_begin_read ();
@@ -91,6 +90,16 @@ void nano::active_elections::stop ()
 	clear ();
 }
 
+auto nano::active_elections::shard_for (nano::qualified_root const & root) -> shard &
+{
+	return shards[std::hash<nano::qualified_root>{}(root) % shard_count];
+}
+
+auto nano::active_elections::shard_for (nano::qualified_root const & root) const -> shard const &
+{
+	return shards[std::hash<nano::qualified_root>{}(root) % shard_count];
+}
+
 void nano::active_elections::block_cemented_callback (nano::secure::transaction const & transaction, std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root)
 {
 	debug_assert (node.block_confirmed (block->hash ()));
@@ -249,13 +258,12 @@ int64_t nano::active_elections::limit (nano::election_behavior behavior) const
 int64_t nano::active_elections::vacancy (nano::election_behavior behavior) const
 {
 	auto election_vacancy = [this] (nano::election_behavior behavior) -> int64_t {
-		nano::lock_guard<nano::mutex> guard{ mutex };
 		switch (behavior)
 		{
 			case nano::election_behavior::manual:
 				return std::numeric_limits<int64_t>::max ();
 			case nano::election_behavior::priority:
-				return limit (nano::election_behavior::priority) - static_cast<int64_t> (roots.size ());
+				return limit (nano::election_behavior::priority) - static_cast<int64_t> (count_total.load ());
 			case nano::election_behavior::hinted:
 			case nano::election_behavior::optimistic:
 				return limit (behavior) - count_by_behavior[behavior];
@@ -271,15 +279,8 @@ int64_t nano::active_elections::vacancy (nano::election_behavior behavior) const
 	return std::min (election_vacancy (behavior), election_winners_vacancy ());
 }
 
-void nano::active_elections::request_confirm (nano::unique_lock<nano::mutex> & lock_a)
+void nano::active_elections::request_confirm ()
 {
-	debug_assert (lock_a.owns_lock ());
-
-	std::size_t const this_loop_target_l (roots.size ());
-	auto const elections_l{ list_active_impl (this_loop_target_l) };
-
-	lock_a.unlock ();
-
 	nano::confirmation_solicitor solicitor (node.network, node.config);
 	solicitor.prepare (node.rep_crawler.principal_representatives (std::numeric_limits<std::size_t>::max ()));
 
@@ -292,40 +293,44 @@ void nano::active_elections::request_confirm (nano::unique_lock<nano::mutex> & l
 	 * Only up to a certain amount of elections are queued for confirmation request and block rebroadcasting. The remaining elections can still be confirmed if votes arrive
 	 * Elections extending the soft config.size limit are flushed after a certain time-to-live cutoff
 	 * Flushed elections are later re-activated via frontier confirmation
+	 * Shards are visited one at a time so only a single shard is copied and locked at once, the first shard rotates every loop so the solicitor limits are not always used up by the same shards
 	 */
-	for (auto const & election_l : elections_l)
+	auto const first_shard_l = request_shard++ % shard_count;
+	for (std::size_t offset_l = 0; offset_l < shard_count; ++offset_l)
 	{
-		bool const confirmed_l (election_l->confirmed ());
-		unconfirmed_count_l += !confirmed_l;
-
-		if (election_l->transition_time (solicitor))
+		for (auto const & election_l : list_shard (shards[(first_shard_l + offset_l) % shard_count]))
 		{
-			erase (election_l->qualified_root);
+			bool const confirmed_l (election_l->confirmed ());
+			unconfirmed_count_l += !confirmed_l;
+
+			if (election_l->transition_time (solicitor))
+			{
+				erase (election_l->qualified_root);
+			}
 		}
 	}
 
 	solicitor.flush ();
-	lock_a.lock ();
 }
 
-void nano::active_elections::cleanup_election (nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election> election)
+void nano::active_elections::cleanup_election (nano::unique_lock<nano::mutex> & lock_a, shard & shard, std::shared_ptr<nano::election> election)
 {
-	debug_assert (!mutex.try_lock ());
-	debug_assert (lock_a.owns_lock ());
+	debug_assert (lock_a.owns_lock () && lock_a.mutex () == &shard.mutex);
 	debug_assert (!election->confirmed () || recently_confirmed.exists (election->qualified_root));
 
 	// Keep track of election count by election type
 	debug_assert (count_by_behavior[election->behavior ()] > 0);
 	count_by_behavior[election->behavior ()]--;
+	count_total--;
 
 	auto blocks_l = election->blocks ();
 	node.vote_router.disconnect (*election);
 
 	// Erase root info
-	auto it = roots.get<tag_root> ().find (election->qualified_root);
-	release_assert (it != roots.get<tag_root> ().end ());
+	auto it = shard.roots.get<tag_root> ().find (election->qualified_root);
+	release_assert (it != shard.roots.get<tag_root> ().end ());
 	entry entry = *it;
-	roots.get<tag_root> ().erase (it);
+	shard.roots.get<tag_root> ().erase (it);
 
 	node.stats.inc (nano::stat::type::active_elections, nano::stat::detail::stopped);
 	node.stats.inc (nano::stat::type::active_elections, election->confirmed () ? nano::stat::detail::confirmed : nano::stat::detail::unconfirmed);
@@ -368,24 +373,44 @@ void nano::active_elections::cleanup_election (nano::unique_lock<nano::mutex> &
 	}
 }
 
-std::vector<std::shared_ptr<nano::election>> nano::active_elections::list_active (std::size_t max_a)
+std::vector<std::shared_ptr<nano::election>> nano::active_elections::list_active (std::size_t max_a) const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-	return list_active_impl (max_a);
-}
-
-std::vector<std::shared_ptr<nano::election>> nano::active_elections::list_active_impl (std::size_t max_a) const
-{
-	std::vector<std::shared_ptr<nano::election>> result_l;
-	result_l.reserve (std::min (max_a, roots.size ()));
+	// Each shard is already ordered by insertion, only the oldest max_a entries of every shard can make it into the result
+	std::vector<std::pair<uint64_t, std::shared_ptr<nano::election>>> sequenced_l;
+	for (auto const & shard : shards)
 	{
-		auto & sorted_roots_l (roots.get<tag_sequenced> ());
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		auto const & sorted_roots_l (shard.roots.get<tag_sequenced> ());
 		std::size_t count_l{ 0 };
 		for (auto i = sorted_roots_l.begin (), n = sorted_roots_l.end (); i != n && count_l < max_a; ++i, ++count_l)
 		{
-			result_l.push_back (i->election);
+			sequenced_l.emplace_back (i->sequence, i->election);
 		}
 	}
+
+	std::sort (sequenced_l.begin (), sequenced_l.end (), [] (auto const & lhs, auto const & rhs) {
+		return lhs.first < rhs.first;
+	});
+
+	std::vector<std::shared_ptr<nano::election>> result_l;
+	result_l.reserve (std::min (max_a, sequenced_l.size ()));
+	for (auto i = sequenced_l.begin (), n = sequenced_l.end (); i != n && result_l.size () < max_a; ++i)
+	{
+		result_l.push_back (std::move (i->second));
+	}
+	return result_l;
+}
+
+std::vector<std::shared_ptr<nano::election>> nano::active_elections::list_shard (shard const & shard) const
+{
+	nano::lock_guard<nano::mutex> guard{ shard.mutex };
+	auto const & sorted_roots_l (shard.roots.get<tag_sequenced> ());
+	std::vector<std::shared_ptr<nano::election>> result_l;
+	result_l.reserve (sorted_roots_l.size ());
+	for (auto const & entry_l : sorted_roots_l)
+	{
+		result_l.push_back (entry_l.election);
+	}
 	return result_l;
 }
 
@@ -398,8 +423,9 @@ void nano::active_elections::request_loop ()
 
 		node.stats.inc (nano::stat::type::active, nano::stat::detail::loop);
 
-		request_confirm (lock);
-		debug_assert (lock.owns_lock ());
+		lock.unlock ();
+		request_confirm ();
+		lock.lock ();
 
 		if (!stopped)
 		{
@@ -415,8 +441,6 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 	debug_assert (block_a);
 	debug_assert (block_a->has_sideband ());
 
-	nano::unique_lock<nano::mutex> lock{ mutex };
-
 	nano::election_insertion_result result;
 
 	if (stopped)
@@ -426,8 +450,12 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 
 	auto const root = block_a->qualified_root ();
 	auto const hash = block_a->hash ();
-	auto const existing = roots.get<tag_root> ().find (root);
-	if (existing == roots.get<tag_root> ().end ())
+	auto & shard = shard_for (root);
+
+	nano::unique_lock<nano::mutex> lock{ shard.mutex };
+
+	auto const existing = shard.roots.get<tag_root> ().find (root);
+	if (existing == shard.roots.get<tag_root> ().end ())
 	{
 		if (!recently_confirmed.exists (root))
 		{
@@ -437,12 +465,13 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 				node.online_reps.observe (rep_a);
 			};
 			result.election = nano::make_shared<nano::election> (node, block_a, nullptr, observe_rep_cb, election_behavior_a);
-			roots.get<tag_root> ().emplace (entry{ root, result.election, std::move (erased_callback_a) });
+			shard.roots.get<tag_root> ().emplace (entry{ root, result.election, std::move (erased_callback_a), next_sequence++ });
 			node.vote_router.connect (hash, result.election);
 
 			// Keep track of election count by election type
 			debug_assert (count_by_behavior[result.election->behavior ()] >= 0);
 			count_by_behavior[result.election->behavior ()]++;
+			count_total++;
 
 			node.stats.inc (nano::stat::type::active_elections, nano::stat::detail::started);
 			node.stats.inc (nano::stat::type::active_elections_started, to_stat_detail (election_behavior_a));
@@ -487,22 +516,23 @@ nano::election_insertion_result nano::active_elections::insert (std::shared_ptr<
 
 bool nano::active_elections::active (nano::qualified_root const & root_a) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return roots.get<tag_root> ().find (root_a) != roots.get<tag_root> ().end ();
+	auto const & shard = shard_for (root_a);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	return shard.roots.get<tag_root> ().find (root_a) != shard.roots.get<tag_root> ().end ();
 }
 
 bool nano::active_elections::active (nano::block const & block_a) const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-	return roots.get<tag_root> ().find (block_a.qualified_root ()) != roots.get<tag_root> ().end ();
+	return active (block_a.qualified_root ());
 }
 
 std::shared_ptr<nano::election> nano::active_elections::election (nano::qualified_root const & root_a) const
 {
 	std::shared_ptr<nano::election> result;
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto existing = roots.get<tag_root> ().find (root_a);
-	if (existing != roots.get<tag_root> ().end ())
+	auto const & shard = shard_for (root_a);
+	nano::lock_guard<nano::mutex> lock{ shard.mutex };
+	auto existing = shard.roots.get<tag_root> ().find (root_a);
+	if (existing != shard.roots.get<tag_root> ().end ())
 	{
 		result = existing->election;
 	}
@@ -516,12 +546,13 @@ bool nano::active_elections::erase (nano::block const & block_a)
 
 bool nano::active_elections::erase (nano::qualified_root const & root_a)
 {
-	nano::unique_lock<nano::mutex> lock{ mutex };
-	auto root_it (roots.get<tag_root> ().find (root_a));
-	if (root_it != roots.get<tag_root> ().end ())
+	auto & shard = shard_for (root_a);
+	nano::unique_lock<nano::mutex> lock{ shard.mutex };
+	auto root_it (shard.roots.get<tag_root> ().find (root_a));
+	if (root_it != shard.roots.get<tag_root> ().end ())
 	{
 		release_assert (root_it->election->qualified_root == root_a);
-		cleanup_election (lock, root_it->election);
+		cleanup_election (lock, shard, root_it->election);
 		return true;
 	}
 	return false;
@@ -529,30 +560,28 @@ bool nano::active_elections::erase (nano::qualified_root const & root_a)
 
 bool nano::active_elections::empty () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return roots.empty ();
+	return count_total == 0;
 }
 
 std::size_t nano::active_elections::size () const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	return roots.size ();
+	return count_total;
 }
 
 std::size_t nano::active_elections::size (nano::election_behavior behavior) const
 {
-	nano::lock_guard<nano::mutex> lock{ mutex };
-	auto count = count_by_behavior[behavior];
+	auto count = count_by_behavior[behavior].load ();
 	debug_assert (count >= 0);
 	return static_cast<std::size_t> (count);
 }
 
 bool nano::active_elections::publish (std::shared_ptr<nano::block> const & block_a)
 {
-	nano::unique_lock<nano::mutex> lock{ mutex };
-	auto existing (roots.get<tag_root> ().find (block_a->qualified_root ()));
+	auto & shard = shard_for (block_a->qualified_root ());
+	nano::unique_lock<nano::mutex> lock{ shard.mutex };
+	auto existing (shard.roots.get<tag_root> ().find (block_a->qualified_root ()));
 	auto result (true);
-	if (existing != roots.get<tag_root> ().end ())
+	if (existing != shard.roots.get<tag_root> ().end ())
 	{
 		auto election (existing->election);
 		lock.unlock ();
@@ -581,9 +610,15 @@ std::size_t nano::active_elections::election_winner_details_size () const
 void nano::active_elections::clear ()
 {
 	// TODO: Call erased_callback for each election
+	for (auto & shard : shards)
 	{
-		nano::lock_guard<nano::mutex> guard{ mutex };
-		roots.clear ();
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		for (auto const & entry : shard.roots)
+		{
+			count_by_behavior[entry.election->behavior ()]--;
+			count_total--;
+		}
+		shard.roots.clear ();
 	}
 
 	vacancy_update ();
@@ -591,14 +626,19 @@ void nano::active_elections::clear ()
 
 nano::container_info nano::active_elections::container_info () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
+	std::size_t roots_size = 0;
+	for (auto const & shard : shards)
+	{
+		nano::lock_guard<nano::mutex> guard{ shard.mutex };
+		roots_size += shard.roots.size ();
+	}
 
 	nano::container_info info;
-	info.put ("roots", roots.size ());
+	info.put ("roots", roots_size);
 	info.put ("election_winner_details", election_winner_details_size ());
-	info.put ("normal", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::priority]));
-	info.put ("hinted", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::hinted]));
-	info.put ("optimistic", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::optimistic]));
+	info.put ("normal", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::priority].load ()));
+	info.put ("hinted", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::hinted].load ()));
+	info.put ("optimistic", static_cast<std::size_t> (count_by_behavior[nano::election_behavior::optimistic].load ()));
 
 	info.add ("recently_confirmed", recently_confirmed.container_info ());
 	info.add ("recently_cemented", recently_cemented.container_info ());
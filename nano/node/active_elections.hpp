@@ -18,6 +18,8 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -67,6 +69,7 @@ private: // Elections
 		nano::qualified_root root;
 		std::shared_ptr<nano::election> election;
 		erased_callback_t erased_callback;
+		uint64_t sequence; // Global insertion order, shards are merged by it
 	};
 
 	friend class nano::election;
@@ -86,7 +89,22 @@ private: // Elections
 			mi::member<entry, nano::qualified_root, &entry::root>>
 	>>;
 	// clang-format on
-	ordered_roots roots;
+
+	/** Elections are split by qualified root, each shard has its own lock so operations on unrelated roots do not contend */
+	class shard final
+	{
+	public:
+		ordered_roots roots;
+		mutable nano::mutex mutex{ mutex_identifier (mutexes::active) };
+	};
+
+	static std::size_t constexpr shard_count = 16;
+	std::array<shard, shard_count> shards;
+
+	shard & shard_for (nano::qualified_root const &);
+	shard const & shard_for (nano::qualified_root const &) const;
+	/** Copies the elections of a single shard, oldest first */
+	std::vector<std::shared_ptr<nano::election>> list_shard (shard const &) const;
 
 public:
 	active_elections (nano::node &, nano::confirming_set &, nano::block_processor &);
@@ -103,8 +121,8 @@ public:
 	bool active (nano::block const &) const;
 	bool active (nano::qualified_root const &) const;
 	std::shared_ptr<nano::election> election (nano::qualified_root const &) const;
-	// Returns a list of elections sorted by difficulty
-	std::vector<std::shared_ptr<nano::election>> list_active (std::size_t = std::numeric_limits<std::size_t>::max ());
+	// Returns a list of elections, oldest first
+	std::vector<std::shared_ptr<nano::election>> list_active (std::size_t = std::numeric_limits<std::size_t>::max ()) const;
 	bool erase (nano::block const &);
 	bool erase (nano::qualified_root const &);
 	bool empty () const;
@@ -131,12 +149,10 @@ public:
 
 private:
 	void request_loop ();
-	void request_confirm (nano::unique_lock<nano::mutex> &);
+	void request_confirm ();
 	// Erase all blocks from active and, if not confirmed, clear digests from network filters
-	void cleanup_election (nano::unique_lock<nano::mutex> & lock_a, std::shared_ptr<nano::election>);
+	void cleanup_election (nano::unique_lock<nano::mutex> & lock_a, shard &, std::shared_ptr<nano::election>);
 	nano::stat::type completion_type (nano::election const & election) const;
-	// Returns a list of elections sorted by difficulty, mutex must be locked
-	std::vector<std::shared_ptr<nano::election>> list_active_impl (std::size_t) const;
 	void activate_successors (nano::secure::transaction const &, std::shared_ptr<nano::block> const & block);
 	void notify_observers (nano::secure::transaction const &, nano::election_status const & status, std::vector<nano::vote_with_weight_info> const & votes) const;
 	void block_cemented_callback (nano::secure::transaction const &, std::shared_ptr<nano::block> const & block, nano::block_hash const & confirmation_root);
@@ -154,6 +170,7 @@ public:
 
 	// TODO: This mutex is currently public because many tests access it
 	// TODO: This is bad. Remove the need to explicitly lock this from any code outside of this class
+	// Elections are guarded by per shard mutexes, this one only coordinates the request loop
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::active) };
 
 private:
@@ -163,11 +180,15 @@ private:
 	// Maximum time an election can be kept active if it is extending the container
 	std::chrono::seconds const election_time_to_live;
 
-	/** Keeps track of number of elections by election behavior (normal, hinted, optimistic) */
-	nano::enum_array<nano::election_behavior, int64_t> count_by_behavior{};
+	/** Keeps track of number of elections by election behavior (normal, hinted, optimistic), readable without locking */
+	nano::enum_array<nano::election_behavior, std::atomic<int64_t>> count_by_behavior{};
+	std::atomic<std::size_t> count_total{ 0 };
+	std::atomic<uint64_t> next_sequence{ 0 };
+	/** Shard the request loop starts from, rotated every loop */
+	std::size_t request_shard{ 0 };
 
 	nano::condition_variable condition;
-	bool stopped{ false };
+	std::atomic<bool> stopped{ false };
 	std::thread thread;
 
 	friend class election;
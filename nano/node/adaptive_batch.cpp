@@ -0,0 +1,40 @@
+#include <nano/lib/utility.hpp>
+#include <nano/node/adaptive_batch.hpp>
+
+#include <algorithm>
+
+nano::adaptive_batch::adaptive_batch (adaptive_batch_config const & config_a, size_t initial) :
+	config{ config_a },
+	current{ std::clamp (initial, config_a.min_size, std::max (config_a.min_size, config_a.max_size)) }
+{
+	debug_assert (config.min_size > 0);
+}
+
+size_t nano::adaptive_batch::next (size_t waiters) const
+{
+	auto const size_l = current.load ();
+	return std::max (config.min_size, size_l / (waiters + 1));
+}
+
+void nano::adaptive_batch::update (size_t requested, size_t count, std::chrono::steady_clock::duration held)
+{
+	auto const max_size = std::max (config.min_size, config.max_size);
+	auto size_l = current.load ();
+	if (held > config.target)
+	{
+		// Decrease quickly, so a burst of expensive items only causes a few long write lock holds
+		size_l = std::max (config.min_size, size_l / 2);
+	}
+	else if (count >= requested && count > 0)
+	{
+		// A full batch means more items are waiting, grow faster the further below the target it finished
+		auto const step = held * 2 < config.target ? size_l : std::max<size_t> (size_l / 8, 1);
+		size_l = std::min (max_size, size_l + step);
+	}
+	current = size_l;
+}
+
+size_t nano::adaptive_batch::size () const
+{
+	return current;
+}
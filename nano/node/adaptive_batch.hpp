@@ -0,0 +1,40 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace nano
+{
+class adaptive_batch_config final
+{
+public:
+	size_t min_size{ 64 };
+	size_t max_size{ 4096 };
+	// Write lock hold time a batch should stay within
+	std::chrono::milliseconds target{ 50 };
+};
+
+/**
+ * Sizes batches processed under a single write transaction from the measured time the write lock was held
+ * Batches that exceed the target time halve the size, full batches that finish early grow it. Other writers waiting for the write lock
+ * get a share of the time by dividing the size between them, so large batches during bootstrap do not delay time sensitive writes
+ * Not thread safe, meant to be used by the single thread processing the batches
+ */
+class adaptive_batch final
+{
+public:
+	explicit adaptive_batch (adaptive_batch_config const &, size_t initial = 256);
+
+	/** Number of items to take for the next batch, `waiters` is the number of other writers holding or waiting for the write lock */
+	size_t next (size_t waiters) const;
+	/** Records the time the write lock was held to process a batch of `count` items taken as a batch of `requested` items */
+	void update (size_t requested, size_t count, std::chrono::steady_clock::duration held);
+	/** Current size without accounting for other writers, safe to call from any thread */
+	size_t size () const;
+
+private:
+	adaptive_batch_config const & config;
+	std::atomic<size_t> current;
+};
+}
@@ -84,6 +84,23 @@ void nano::backlog_population::populate_backlog (nano::unique_lock<nano::mutex>
 {
 	debug_assert (config.frequency > 0);
 
+	// Once complete the index holds every unconfirmed account, so fully cemented accounts no longer need to be visited
+	if (ledger.cache.unconfirmed.complete ())
+	{
+		populate_from_index (lock);
+	}
+	else
+	{
+		populate_from_scan (lock);
+	}
+}
+
+void nano::backlog_population::populate_from_scan (nano::unique_lock<nano::mutex> & lock)
+{
+	stats.inc (nano::stat::type::backlog, nano::stat::detail::full_scan);
+
+	// Every unconfirmed account is either seen by this scan or recorded by the ledger while it runs, which rebuilds the index
+	auto const token = ledger.cache.unconfirmed.scan_begin ();
 	const auto chunk_size = config.batch_size / config.frequency;
 	auto done = false;
 	nano::account next = 0;
@@ -110,7 +127,15 @@ void nano::backlog_population::populate_backlog (nano::unique_lock<nano::mutex>
 				auto const & account = it->first;
 				auto const & account_info = it->second;
 
-				activate (transaction, account, account_info);
+				// The ledger may have recorded a longer chain since this transaction began, that entry must not be overwritten with the stale count
+				if (activate (transaction, account, account_info))
+				{
+					ledger.cache.unconfirmed.put_if_absent (account, account_info.block_count);
+				}
+				else
+				{
+					ledger.cache.unconfirmed.erase (account, account_info.block_count);
+				}
 
 				next = account.number () + 1;
 			}
@@ -120,12 +145,61 @@ void nano::backlog_population::populate_backlog (nano::unique_lock<nano::mutex>
 
 		lock.lock ();
 
+		// Give the rest of the node time to progress without holding database lock
+		condition.wait_for (lock, std::chrono::milliseconds{ 1000 / config.frequency });
+	}
+	if (done)
+	{
+		ledger.cache.unconfirmed.scan_end (token);
+	}
+}
+
+void nano::backlog_population::populate_from_index (nano::unique_lock<nano::mutex> & lock)
+{
+	stats.inc (nano::stat::type::backlog, nano::stat::detail::index_scan);
+
+	const auto chunk_size = config.batch_size / config.frequency;
+	auto done = false;
+	nano::account next = 0;
+	while (!stopped && !done)
+	{
+		lock.unlock ();
+
+		{
+			auto transaction = ledger.tx_begin_read ();
+
+			auto const batch = ledger.cache.unconfirmed.next (next, chunk_size);
+			for (auto const & [account, block_count] : batch)
+			{
+				stats.inc (nano::stat::type::backlog, nano::stat::detail::total);
+
+				// Entries are only removed if the chain did not change after it was read, so a block processed concurrently keeps the account indexed
+				auto const account_info = ledger.store.account.get (transaction, account);
+				if (!account_info)
+				{
+					stats.inc (nano::stat::type::backlog, nano::stat::detail::index_erased);
+					ledger.cache.unconfirmed.erase (account, 0);
+				}
+				else if (!activate (transaction, account, *account_info))
+				{
+					stats.inc (nano::stat::type::backlog, nano::stat::detail::index_erased);
+					ledger.cache.unconfirmed.erase (account, account_info->block_count);
+				}
+
+				next = account.number () + 1;
+			}
+
+			done = batch.size () < chunk_size || next.is_zero ();
+		}
+
+		lock.lock ();
+
 		// Give the rest of the node time to progress without holding database lock
 		condition.wait_for (lock, std::chrono::milliseconds{ 1000 / config.frequency });
 	}
 }
 
-void nano::backlog_population::activate (secure::transaction const & transaction, nano::account const & account, nano::account_info const & account_info)
+bool nano::backlog_population::activate (secure::transaction const & transaction, nano::account const & account, nano::account_info const & account_info)
 {
 	auto const maybe_conf_info = ledger.store.confirmation_height.get (transaction, account);
 	auto const conf_info = maybe_conf_info.value_or (nano::confirmation_height_info{});
@@ -139,7 +213,9 @@ void nano::backlog_population::activate (secure::transaction const & transaction
 
 		schedulers.optimistic.activate (account, account_info, conf_info);
 		schedulers.priority.activate (transaction, account, account_info, conf_info);
+		return true;
 	}
+	return false;
 }
 
 /*
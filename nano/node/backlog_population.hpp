@@ -67,7 +67,12 @@ private:
 	void run ();
 	bool predicate () const;
 	void populate_backlog (nano::unique_lock<nano::mutex> & lock);
-	void activate (secure::transaction const &, nano::account const &, nano::account_info const &);
+	/** Visits every account in the ledger, rebuilding the unconfirmed accounts index along the way */
+	void populate_from_scan (nano::unique_lock<nano::mutex> & lock);
+	/** Visits only accounts in the unconfirmed accounts index */
+	void populate_from_index (nano::unique_lock<nano::mutex> & lock);
+	/** Returns true if the account has unconfirmed blocks and was activated */
+	bool activate (secure::transaction const &, nano::account const &, nano::account_info const &);
 
 private:
 	/** This is a manual trigger, the ongoing backlog population does not use this.
@@ -1,15 +1,18 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/enum_util.hpp>
+#include <nano/lib/thread_pool.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/node/active_elections.hpp>
 #include <nano/node/blockprocessor.hpp>
 #include <nano/node/local_vote_history.hpp>
 #include <nano/node/node.hpp>
+#include <nano/node/signatures.hpp>
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/store/component.hpp>
 
+#include <unordered_map>
 #include <utility>
 
 /*
@@ -34,6 +37,83 @@ void nano::block_processor::context::set_result (result_t const & result)
 	promise.set_value (result);
 }
 
+/*
+ * block_processor::prepared_batch
+ */
+
+/**
+ * Batch of blocks going through the read-only stage on the worker pool. Blocks are partitioned by account chain and partitions are claimed
+ * through an atomic counter, so a committer waiting on a batch whose tasks have not started yet (or never will) prepares it itself
+ */
+class nano::block_processor::prepared_batch final
+{
+public:
+	prepared_batch (nano::block_processor & processor_a, std::deque<context> batch_a, std::size_t requested_a, std::size_t partition_count) :
+		requested{ requested_a },
+		processor{ processor_a },
+		batch{ std::move (batch_a) },
+		partitions (partition_count)
+	{
+		debug_assert (partition_count > 0);
+		// Legacy blocks other than open do not carry their account, they follow the partition of their previous block when it is part of this batch
+		// and otherwise fall back to their root, so a chain arriving in order stays in a single partition
+		std::unordered_map<nano::block_hash, nano::account> keys;
+		for (auto & ctx : batch)
+		{
+			auto const & block = *ctx.block;
+			auto key = block.account_field ();
+			if (!key)
+			{
+				auto existing = keys.find (block.previous ());
+				key = existing != keys.end () ? existing->second : block.root ().as_account ();
+			}
+			keys.emplace (block.hash (), *key);
+			partitions[key->qwords[0] % partitions.size ()].push_back (&ctx);
+		}
+	}
+
+	void run ()
+	{
+		for (auto index = next++; index < partitions.size (); index = next++)
+		{
+			processor.precheck (partitions[index]);
+			// Whoever finishes the last partition verifies signatures for the whole batch, the signature checker spreads those over its own pool
+			if (++completed == partitions.size ())
+			{
+				processor.verify_signatures (batch);
+				{
+					nano::lock_guard<nano::mutex> guard{ mutex };
+					done = true;
+				}
+				condition.notify_all ();
+			}
+		}
+	}
+
+	std::deque<context> wait ()
+	{
+		run ();
+		nano::unique_lock<nano::mutex> lock{ mutex };
+		condition.wait (lock, [this] () { return done; });
+		return std::move (batch);
+	}
+
+	// Batch size asked for when this batch was taken from the queue
+	std::size_t const requested;
+	// Set by the committer when a rollback happened while this batch was being prepared, so blocks found by the read-only stage may be gone
+	bool stale{ false };
+
+private:
+	nano::block_processor & processor;
+	std::deque<context> batch;
+	std::vector<std::vector<context *>> partitions;
+	std::atomic<std::size_t> next{ 0 };
+	std::atomic<std::size_t> completed{ 0 };
+	bool done{ false };
+	nano::mutex mutex;
+	nano::condition_variable condition;
+};
+
 /*
  * block_processor
  */
@@ -41,7 +121,8 @@ void nano::block_processor::context::set_result (result_t const & result)
 nano::block_processor::block_processor (nano::node & node_a) :
 	config{ node_a.config.block_processor },
 	node (node_a),
-	next_log (std::chrono::steady_clock::now ())
+	next_log (std::chrono::steady_clock::now ()),
+	batch_size{ config.batch }
 {
 	batch_processed.add ([this] (auto const & items) {
 		// For every batch item: notify the 'processed' observer.
@@ -78,6 +159,11 @@ nano::block_processor::block_processor (nano::node & node_a) :
 				return 1;
 		}
 	};
+
+	if (config.bootstrap_threads > 0)
+	{
+		workers = std::make_unique<nano::thread_pool> (static_cast<unsigned> (config.bootstrap_threads), nano::thread_role::name::block_processing_workers);
+	}
 }
 
 nano::block_processor::~block_processor ()
@@ -107,6 +193,10 @@ void nano::block_processor::stop ()
 	{
 		thread.join ();
 	}
+	if (workers)
+	{
+		workers->stop ();
+	}
 }
 
 // TODO: Remove and replace all checks with calls to size (block_source)
@@ -229,10 +319,13 @@ void nano::block_processor::rollback_competitor (secure::write_transaction const
 
 void nano::block_processor::run ()
 {
+	// Next bootstrap batch, prepared on the workers while the current batch is committed
+	std::shared_ptr<prepared_batch> prefetched;
+
 	nano::unique_lock<nano::mutex> lock{ mutex };
 	while (!stopped)
 	{
-		if (!queue.empty ())
+		if (!queue.empty () || prefetched)
 		{
 			// TODO: Cleaner periodical logging
 			if (should_log ())
@@ -242,7 +335,7 @@ void nano::block_processor::run ()
 				queue.size ({ nano::block_source::forced }));
 			}
 
-			auto processed = process_batch (lock);
+			auto processed = process_batch (lock, prefetched);
 			debug_assert (!lock.owns_lock ());
 
 			// Set results for futures when not holding the lock
@@ -309,43 +402,121 @@ auto nano::block_processor::next_batch (size_t max_count) -> std::deque<context>
 	return results;
 }
 
-auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock) -> processed_batch_t
+bool nano::block_processor::should_prepare_async () const
+{
+	debug_assert (!mutex.try_lock ());
+	return workers && queue.size ({ nano::block_source::bootstrap }) > 0;
+}
+
+auto nano::block_processor::prepare_async (size_t requested) -> std::shared_ptr<prepared_batch>
+{
+	debug_assert (!mutex.try_lock ());
+	debug_assert (workers);
+
+	auto const partitions = workers->get_num_threads ();
+	auto prepared = std::make_shared<prepared_batch> (*this, next_batch (requested), requested, partitions);
+	for (unsigned i = 0; i < partitions; ++i)
+	{
+		workers->push_task ([prepared] () {
+			prepared->run ();
+		});
+	}
+	return prepared;
+}
+
+auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock, std::shared_ptr<prepared_batch> & prefetched) -> processed_batch_t
 {
 	debug_assert (lock.owns_lock ());
 	debug_assert (!mutex.try_lock ());
-	debug_assert (!queue.empty ());
+	debug_assert (!queue.empty () || prefetched);
+
+	// Batches shrink while other writers are waiting for the write lock
+	auto requested = batch_size.next (node.store.write_queue.size ());
 
-	auto batch = next_batch (256);
+	std::shared_ptr<prepared_batch> prepared = std::move (prefetched);
+	std::deque<context> batch;
+	if (prepared)
+	{
+		requested = prepared->requested;
+	}
+	else if (should_prepare_async ())
+	{
+		prepared = prepare_async (requested);
+	}
+	else
+	{
+		batch = next_batch (requested);
+	}
+	// Bootstrap blocks of the following batch get prepared on the workers while this batch holds the write transaction
+	if (!queue.empty () && should_prepare_async ())
+	{
+		prefetched = prepare_async (batch_size.next (node.store.write_queue.size ()));
+	}
 
 	lock.unlock ();
 
-	auto transaction = node.ledger.tx_begin_write (nano::store::writer::blockprocessor);
+	// Rolling back blocks can invalidate what the read-only stage found
+	bool rolled_back = false;
+
+	if (prepared)
+	{
+		batch = prepared->wait ();
+		rolled_back = prepared->stale;
+	}
+	else
+	{
+		std::vector<context *> contexts;
+		for (auto & ctx : batch)
+		{
+			contexts.push_back (&ctx);
+		}
+		// Everything that does not need to modify the ledger is done before acquiring the write lock, so other writers can interleave
+		precheck (contexts);
+		// Signatures are checked before acquiring the write lock, so the ledger only needs to look up the results
+		verify_signatures (batch);
+	}
 
 	nano::timer<std::chrono::milliseconds> timer;
-	timer.start ();
 
 	// Processing blocks
 	size_t number_of_blocks_processed = 0;
 	size_t number_of_forced_processed = 0;
 
 	processed_batch_t processed;
-	for (auto & ctx : batch)
 	{
-		auto const hash = ctx.block->hash ();
-		bool const force = ctx.source == nano::block_source::forced;
-
-		transaction.refresh_if_needed ();
+		auto transaction = node.ledger.tx_begin_write (nano::store::writer::blockprocessor);
+		timer.start ();
 
-		if (force)
+		for (auto & ctx : batch)
 		{
-			number_of_forced_processed++;
-			rollback_competitor (transaction, *ctx.block);
-		}
+			auto const hash = ctx.block->hash ();
+			bool const force = ctx.source == nano::block_source::forced;
 
-		number_of_blocks_processed++;
+			transaction.refresh_if_needed ();
 
-		auto result = process_one (transaction, ctx, force);
-		processed.emplace_back (result, std::move (ctx));
+			if (force)
+			{
+				number_of_forced_processed++;
+				rollback_competitor (transaction, *ctx.block);
+				rolled_back = true;
+			}
+			if (rolled_back)
+			{
+				ctx.exists = false;
+			}
+
+			number_of_blocks_processed++;
+
+			auto result = process_one (transaction, ctx, force);
+			processed.emplace_back (result, std::move (ctx));
+		}
+	}
+	// Hold time includes the commit
+	batch_size.update (requested, number_of_blocks_processed, timer.since_start ());
+
+	if (rolled_back && prefetched)
+	{
+		prefetched->stale = true;
 	}
 
 	if (number_of_blocks_processed != 0 && timer.stop () > std::chrono::milliseconds (100))
@@ -356,11 +527,107 @@ auto nano::block_processor::process_batch (nano::unique_lock<nano::mutex> & lock
 	return processed;
 }
 
+void nano::block_processor::precheck (std::vector<context *> const & contexts)
+{
+	if (contexts.empty ())
+	{
+		return;
+	}
+
+	size_t existing = 0;
+
+	auto transaction = node.ledger.tx_begin_read ();
+	for (auto * ctx_ptr : contexts)
+	{
+		auto & ctx = *ctx_ptr;
+		auto const & block = *ctx.block;
+
+		// Epoch blocks have their previous block checked before being checked for duplicates, leave those to the ledger to keep results unchanged
+		bool const epoch = block.type () == nano::block_type::state && node.ledger.is_epoch_link (block.link_field ().value ());
+		if (!epoch && node.ledger.any.block_exists_or_pruned (transaction, block.hash ()))
+		{
+			// Only a hint, existence is confirmed again under the write transaction since the block may be rolled back in the meantime
+			ctx.exists = true;
+			++existing;
+			continue;
+		}
+
+		// Load entries the ledger reads when processing this block, so those reads do not hit cold pages while the write lock is held
+		if (!block.previous ().is_zero ())
+		{
+			node.ledger.any.block_exists (transaction, block.previous ());
+		}
+		if (auto account = block.account_field ())
+		{
+			node.ledger.any.account_get (transaction, *account);
+		}
+		if (auto source = block.source_field ())
+		{
+			node.ledger.any.block_exists_or_pruned (transaction, *source);
+		}
+	}
+
+	node.stats.add (nano::stat::type::blockprocessor, nano::stat::detail::precheck_existing, existing);
+}
+
+void nano::block_processor::verify_signatures (std::deque<context> & batch)
+{
+	// Only state and open blocks carry their signing account, legacy send/receive/change blocks need a ledger lookup and are verified by the ledger itself
+	nano::signature_check_set accounts;
+	std::vector<context *> account_contexts;
+	for (auto & ctx : batch)
+	{
+		auto const & block = *ctx.block;
+		if (ctx.exists)
+		{
+			continue; // Duplicates resolve as `old` without looking at the signature
+		}
+		if (block.type () == nano::block_type::state || block.type () == nano::block_type::open)
+		{
+			accounts.add (block.hash (), block.account_field ().value (), block.block_signature ());
+			account_contexts.push_back (&ctx);
+		}
+	}
+	node.checker.verify (accounts);
+
+	// State blocks with an epoch link that are not signed by the account can still be valid epoch blocks
+	nano::signature_check_set epochs;
+	std::vector<context *> epoch_contexts;
+	for (std::size_t i = 0; i < account_contexts.size (); ++i)
+	{
+		auto & ctx = *account_contexts[i];
+		auto const & block = *ctx.block;
+		if (accounts.valid (i))
+		{
+			ctx.verification = nano::signature_verification::valid;
+		}
+		else if (block.type () == nano::block_type::state && node.ledger.is_epoch_link (block.link_field ().value ()))
+		{
+			epochs.add (block.hash (), node.ledger.epoch_signer (block.link_field ().value ()), block.block_signature ());
+			epoch_contexts.push_back (&ctx);
+		}
+		else
+		{
+			ctx.verification = nano::signature_verification::invalid;
+		}
+	}
+	node.checker.verify (epochs);
+
+	for (std::size_t i = 0; i < epoch_contexts.size (); ++i)
+	{
+		epoch_contexts[i]->verification = epochs.valid (i) ? nano::signature_verification::valid_epoch : nano::signature_verification::invalid;
+	}
+
+	node.stats.add (nano::stat::type::blockprocessor, nano::stat::detail::signatures_verified, accounts.size () + epochs.size ());
+}
+
 nano::block_status nano::block_processor::process_one (secure::write_transaction const & transaction_a, context const & context, bool const forced_a)
 {
 	auto block = context.block;
 	auto const hash = block->hash ();
-	nano::block_status result = node.ledger.process (transaction_a, block);
+	// A block found by the read-only stage is looked up again on the now warm page, anything rolled back since then goes through the ledger
+	bool const exists = context.exists && node.ledger.any.block_exists_or_pruned (transaction_a, hash);
+	nano::block_status result = exists ? nano::block_status::old : node.ledger.process (transaction_a, block, context.verification);
 
 	node.stats.inc (nano::stat::type::blockprocessor_result, to_stat_detail (result));
 	node.stats.inc (nano::stat::type::blockprocessor_source, to_stat_detail (context.source));
@@ -465,6 +732,7 @@ nano::container_info nano::block_processor::container_info () const
 	nano::container_info info;
 	info.put ("blocks", queue.size ());
 	info.put ("forced", queue.size ({ nano::block_source::forced }));
+	info.put ("batch_size", batch_size.size ());
 	info.add ("queue", queue.container_info ());
 	return info;
 }
@@ -484,6 +752,10 @@ nano::error nano::block_processor_config::serialize (nano::tomlconfig & toml) co
 	toml.put ("priority_live", priority_live, "Priority for live network blocks. Higher priority gets processed more frequently. \ntype:uint64");
 	toml.put ("priority_bootstrap", priority_bootstrap, "Priority for bootstrap blocks. Higher priority gets processed more frequently. \ntype:uint64");
 	toml.put ("priority_local", priority_local, "Priority for local RPC blocks. Higher priority gets processed more frequently. \ntype:uint64");
+	toml.put ("batch_min_size", batch.min_size, "Minimum number of blocks processed under a single write transaction. \ntype:uint64");
+	toml.put ("batch_max_size", batch.max_size, "Maximum number of blocks processed under a single write transaction. The size adapts between the minimum and maximum to stay within batch_target_time, and shrinks while other components wait to write. \ntype:uint64");
+	toml.put ("batch_target_time", batch.target.count (), "Target time to hold the write lock for when processing a batch of blocks. \ntype:milliseconds");
+	toml.put ("bootstrap_threads", bootstrap_threads, "Number of worker threads preparing bootstrap blocks in parallel, partitioned by account chain. Blocks are still applied to the ledger in order by a single thread. 0 disables parallel preparation. \ntype:uint64");
 
 	return toml.get_error ();
 }
@@ -495,6 +767,12 @@ nano::error nano::block_processor_config::deserialize (nano::tomlconfig & toml)
 	toml.get ("priority_live", priority_live);
 	toml.get ("priority_bootstrap", priority_bootstrap);
 	toml.get ("priority_local", priority_local);
+	toml.get ("batch_min_size", batch.min_size);
+	toml.get ("batch_max_size", batch.max_size);
+	auto batch_target_l = batch.target.count ();
+	toml.get ("batch_target_time", batch_target_l);
+	batch.target = std::chrono::milliseconds (batch_target_l);
+	toml.get ("bootstrap_threads", bootstrap_threads);
 
 	return toml.get_error ();
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nano/lib/logging.hpp>
+#include <nano/node/adaptive_batch.hpp>
 #include <nano/node/fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/secure/common.hpp>
@@ -13,6 +14,8 @@
 
 namespace nano
 {
+class thread_pool;
+
 enum class block_source
 {
 	unknown = 0,
@@ -46,6 +49,12 @@ public:
 	size_t priority_live{ 1 };
 	size_t priority_bootstrap{ 8 };
 	size_t priority_local{ 16 };
+
+	// Number of blocks processed under a single write transaction adapts to the time the write lock is held
+	nano::adaptive_batch_config batch{ 64, 4096, std::chrono::milliseconds{ 50 } };
+
+	// Number of worker threads preparing bootstrap blocks in parallel, partitioned by account chain. 0 disables parallel preparation
+	size_t bootstrap_threads{ 0 };
 };
 
 /**
@@ -67,6 +76,9 @@ public: // Context
 		nano::block_source source;
 		callback_t callback;
 		std::chrono::steady_clock::time_point arrival{ std::chrono::steady_clock::now () };
+		nano::signature_verification verification{ nano::signature_verification::unknown };
+		// Block was already present in the ledger when checked by the read-only stage, confirmed again under the write transaction
+		bool exists{ false };
 
 		std::future<result_t> get_future ();
 
@@ -110,7 +122,12 @@ private:
 	void rollback_competitor (secure::write_transaction const &, nano::block const & block);
 	nano::block_status process_one (secure::write_transaction const &, context const &, bool forced = false);
 	void queue_unchecked (secure::write_transaction const &, nano::hash_or_account const &);
-	processed_batch_t process_batch (nano::unique_lock<nano::mutex> &);
+	class prepared_batch;
+	processed_batch_t process_batch (nano::unique_lock<nano::mutex> &, std::shared_ptr<prepared_batch> & prefetched);
+	void precheck (std::vector<context *> const &);
+	void verify_signatures (std::deque<context> &);
+	bool should_prepare_async () const;
+	std::shared_ptr<prepared_batch> prepare_async (size_t requested);
 	std::deque<context> next_batch (size_t max_count);
 	context next ();
 	bool add_impl (context, std::shared_ptr<nano::transport::channel> const & channel = nullptr);
@@ -123,10 +140,13 @@ private:
 	nano::fair_queue<context, nano::block_source> queue;
 
 	std::chrono::steady_clock::time_point next_log;
+	nano::adaptive_batch batch_size;
 
 	bool stopped{ false };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::block_processor) };
 	std::thread thread;
+	// Only created when bootstrap_threads is non zero
+	std::unique_ptr<nano::thread_pool> workers;
 };
 }
@@ -156,7 +156,7 @@ void nano::bootstrap_server::respond (nano::asc_pull_ack & response, std::shared
 		}
 		void operator() (nano::asc_pull_ack::blocks_payload const & pld)
 		{
-			stats.add (nano::stat::type::bootstrap_server, nano::stat::detail::blocks, nano::stat::dir::out, pld.blocks.size ());
+			stats.add (nano::stat::type::bootstrap_server, nano::stat::detail::blocks, nano::stat::dir::out, pld.size ());
 		}
 		void operator() (nano::asc_pull_ack::account_info_payload const & pld)
 		{
@@ -285,16 +285,14 @@ nano::asc_pull_ack nano::bootstrap_server::prepare_response (secure::transaction
 {
 	debug_assert (count <= max_blocks); // Should be filtered out earlier
 
-	auto blocks = prepare_blocks (transaction, start_block, count);
-	debug_assert (blocks.size () <= count);
+	nano::asc_pull_ack::blocks_payload response_payload{};
+	response_payload.serialized_count = prepare_blocks (transaction, start_block, count, response_payload.serialized_blocks);
+	debug_assert (response_payload.serialized_count <= count);
 
 	nano::asc_pull_ack response{ network_constants };
 	response.id = id;
 	response.type = nano::asc_pull_type::blocks;
-
-	nano::asc_pull_ack::blocks_payload response_payload{};
-	response_payload.blocks = blocks;
-	response.payload = response_payload;
+	response.payload = std::move (response_payload);
 
 	response.update_header ();
 	return response;
@@ -313,21 +311,18 @@ nano::asc_pull_ack nano::bootstrap_server::prepare_empty_blocks_response (nano::
 	return response;
 }
 
-std::deque<std::shared_ptr<nano::block>> nano::bootstrap_server::prepare_blocks (secure::transaction const & transaction, nano::block_hash start_block, std::size_t count) const
+std::size_t nano::bootstrap_server::prepare_blocks (secure::transaction const & transaction, nano::block_hash start_block, std::size_t count, std::vector<uint8_t> & serialized) const
 {
 	debug_assert (count <= max_blocks); // Should be filtered out earlier
 
-	std::deque<std::shared_ptr<nano::block>> result;
-	if (!start_block.is_zero ())
+	std::size_t result = 0;
+	nano::block_hash current = start_block;
+	nano::block_hash successor{ 0 };
+	// Blocks are copied in their stored serialization, following successors recorded in the sideband, without materializing block objects
+	while (!current.is_zero () && result < count && !ledger.store.block.get_serialized (transaction, current, serialized, successor))
 	{
-		std::shared_ptr<nano::block> current = ledger.any.block_get (transaction, start_block);
-		while (current && result.size () < count)
-		{
-			result.push_back (current);
-
-			auto successor = current->sideband ().successor;
-			current = ledger.any.block_get (transaction, successor);
-		}
+		++result;
+		current = successor;
 	}
 	return result;
 }
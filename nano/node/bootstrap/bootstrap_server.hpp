@@ -64,7 +64,8 @@ private:
 	nano::asc_pull_ack process (secure::transaction const &, nano::asc_pull_req::id_t id, nano::asc_pull_req::blocks_payload const & request) const;
 	nano::asc_pull_ack prepare_response (secure::transaction const &, nano::asc_pull_req::id_t id, nano::block_hash start_block, std::size_t count) const;
 	nano::asc_pull_ack prepare_empty_blocks_response (nano::asc_pull_req::id_t id) const;
-	std::deque<std::shared_ptr<nano::block>> prepare_blocks (secure::transaction const &, nano::block_hash start_block, std::size_t count) const;
+	/** Appends up to `count` blocks of the chain starting at `start_block` to `serialized`, returns the number of blocks appended */
+	std::size_t prepare_blocks (secure::transaction const &, nano::block_hash start_block, std::size_t count, std::vector<uint8_t> & serialized) const;
 
 	/*
 	 * Account info request
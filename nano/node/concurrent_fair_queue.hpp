@@ -0,0 +1,496 @@
+#pragma once
+
+#include <nano/lib/utility.hpp>
+#include <nano/node/fair_queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace nano
+{
+/**
+ * Bounded ring buffer which any number of threads can push to without locking, popping must be serialized by the caller
+ * Each cell carries a sequence number telling whether it is free for the push at that position or holds the value for the pop at that position
+ */
+template <typename T>
+class mpsc_ring final
+{
+public:
+	explicit mpsc_ring (size_t min_capacity) :
+		capacity{ std::bit_ceil (std::max<size_t> (min_capacity, 2)) },
+		cells{ std::make_unique<cell[]> (capacity) }
+	{
+		for (size_t i = 0; i < capacity; ++i)
+		{
+			cells[i].sequence.store (i, std::memory_order_relaxed);
+		}
+	}
+
+	/** @return false if the ring is full */
+	bool push (T value)
+	{
+		auto position = push_position.load (std::memory_order_relaxed);
+		cell * target = nullptr;
+		while (true)
+		{
+			target = &cells[position & (capacity - 1)];
+			auto const sequence = target->sequence.load (std::memory_order_acquire);
+			auto const difference = static_cast<std::intptr_t> (sequence) - static_cast<std::intptr_t> (position);
+			if (difference == 0)
+			{
+				if (push_position.compare_exchange_weak (position, position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (difference < 0)
+			{
+				return false; // Full
+			}
+			else
+			{
+				position = push_position.load (std::memory_order_relaxed);
+			}
+		}
+		target->value.emplace (std::move (value));
+		target->sequence.store (position + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** @return nullopt if empty or if the value at the head is still being written by a producer */
+	std::optional<T> pop ()
+	{
+		auto & target = cells[pop_position & (capacity - 1)];
+		if (target.sequence.load (std::memory_order_acquire) != pop_position + 1)
+		{
+			return std::nullopt;
+		}
+		std::optional<T> result{ std::move (target.value) };
+		target.value.reset ();
+		target.sequence.store (pop_position + capacity, std::memory_order_release);
+		++pop_position;
+		return result;
+	}
+
+	size_t const capacity;
+
+private:
+	struct cell
+	{
+		std::atomic<size_t> sequence;
+		std::optional<T> value;
+	};
+
+	std::unique_ptr<cell[]> cells;
+	alignas (64) std::atomic<size_t> push_position{ 0 };
+	alignas (64) size_t pop_position{ 0 };
+};
+
+/**
+ * Variant of fair_queue which producers can push to concurrently without an external mutex
+ * Each origin gets its own lock-free ring buffer. Origins are looked up in an immutable snapshot of the origin map which is published through an atomic
+ * pointer, the mutex is only taken to add or clean up origins, which copies the map and publishes the copy. Replaced snapshots are freed once no reader
+ * is left, readers announce themselves on one of several cache line sized counters so producers do not contend on a single one
+ * Consumers are serialized by an internal mutex and take turns over origins round-robin, honoring priorities the same way fair_queue does
+ * Ring capacity is fixed when an origin is first seen, later max_size updates are limited to that capacity
+ */
+template <typename Request, typename Source>
+class concurrent_fair_queue final
+{
+public:
+	using origin_type = typename nano::fair_queue<Request, Source>::origin_type;
+	using value_type = std::pair<Request, origin_type>;
+
+private:
+	struct entry
+	{
+		nano::mpsc_ring<Request> requests;
+		// Reserved by producers before pushing, so the ring never holds more than max_size requests
+		std::atomic<size_t> count{ 0 };
+		std::atomic<size_t> priority;
+		std::atomic<size_t> max_size;
+
+		entry (size_t max_size_a, size_t priority_a) :
+			requests{ max_size_a },
+			priority{ priority_a },
+			max_size{ max_size_a }
+		{
+		}
+
+		/** Reserves a slot in the ring, a successful reservation must be followed by push */
+		bool reserve ()
+		{
+			auto const limit = std::min (max_size.load (), requests.capacity);
+			if (count.fetch_add (1) >= limit)
+			{
+				count.fetch_sub (1);
+				return false;
+			}
+			return true;
+		}
+
+		void push (Request request)
+		{
+			// Slots are only released by pop after the ring cell is free again, so a reservation always fits
+			auto pushed = requests.push (std::move (request));
+			release_assert (pushed);
+		}
+
+		std::optional<Request> pop ()
+		{
+			auto request = requests.pop ();
+			if (request)
+			{
+				count.fetch_sub (1);
+			}
+			return request;
+		}
+	};
+
+	// Entries are shared by consecutive snapshots, a snapshot is never modified once published
+	using queues_t = std::map<origin_type, std::shared_ptr<entry>>;
+
+	struct alignas (64) reader_slot
+	{
+		std::atomic<size_t> count{ 0 };
+	};
+	static size_t constexpr reader_slots = 16;
+
+	/** Keeps the snapshot current at construction alive until destroyed */
+	class reader final
+	{
+	public:
+		explicit reader (concurrent_fair_queue const & queue) :
+			slot{ queue.readers[slot_index ()].count }
+		{
+			// Announced before loading, so a writer replacing the snapshot afterwards sees this reader when deciding whether to free it
+			slot.fetch_add (1);
+			queues = queue.current.load ();
+		}
+
+		~reader ()
+		{
+			slot.fetch_sub (1);
+		}
+
+		queues_t const & operator* () const
+		{
+			return *queues;
+		}
+
+		queues_t const * operator->() const
+		{
+			return queues;
+		}
+
+	private:
+		static size_t slot_index ()
+		{
+			static thread_local size_t const index = std::hash<std::thread::id>{}(std::this_thread::get_id ()) % reader_slots;
+			return index;
+		}
+
+		std::atomic<size_t> & slot;
+		queues_t const * queues;
+	};
+
+public:
+	concurrent_fair_queue ()
+	{
+		std::lock_guard guard{ queues_mutex };
+		publish (queues_t{});
+	}
+
+	size_t size (origin_type source) const
+	{
+		reader queues{ *this };
+		auto it = queues->find (source);
+		return it == queues->end () ? 0 : it->second->count.load ();
+	}
+
+	size_t max_size (origin_type source) const
+	{
+		reader queues{ *this };
+		auto it = queues->find (source);
+		return it == queues->end () ? 0 : it->second->max_size.load ();
+	}
+
+	size_t priority (origin_type source) const
+	{
+		reader queues{ *this };
+		auto it = queues->find (source);
+		return it == queues->end () ? 0 : it->second->priority.load ();
+	}
+
+	size_t size () const
+	{
+		return total_size;
+	}
+
+	bool empty () const
+	{
+		return size () == 0;
+	}
+
+	size_t queues_size () const
+	{
+		reader queues{ *this };
+		return queues->size ();
+	}
+
+	/**
+	 * Push a request to the appropriate queue based on the source, safe to call from any number of threads
+	 * Request will be dropped if the queue is full
+	 * @return true if added, false if dropped
+	 */
+	bool push (Request request, origin_type source)
+	{
+		{
+			reader queues{ *this };
+			auto it = queues->find (source);
+			if (it != queues->end ())
+			{
+				return push (*it->second, std::move (request));
+			}
+		}
+
+		// Create a new queue if it doesn't exist
+		auto max_size = max_size_query (source);
+		auto priority = priority_query (source);
+
+		std::shared_ptr<entry> queue;
+		{
+			std::lock_guard guard{ queues_mutex };
+			// Another producer may have added the origin in the meantime
+			auto const & published = *snapshots.back ();
+			if (auto it = published.find (source); it != published.end ())
+			{
+				queue = it->second;
+			}
+			else
+			{
+				queue = std::make_shared<entry> (max_size, priority);
+				auto updated = published;
+				updated.emplace (source, queue);
+				publish (std::move (updated));
+			}
+		}
+		// Kept alive by the local reference even if cleaned up right away
+		return push (*queue, std::move (request));
+	}
+
+	/**
+	 * Should be called periodically to clean up stale channels and update queue priorities and max sizes
+	 * Consumer side, serialized with next_batch
+	 */
+	bool periodic_update (std::chrono::milliseconds interval = std::chrono::milliseconds{ 1000 * 30 })
+	{
+		std::lock_guard consumer_guard{ consumer_mutex };
+		return periodic_update_impl (interval);
+	}
+
+	/**
+	 * Takes up to max_count requests, safe to call from multiple consumer threads
+	 * Requests still being written by producers are left for the next call, so the result may be smaller than the queue size
+	 */
+	std::deque<value_type> next_batch (size_t max_count)
+	{
+		std::lock_guard consumer_guard{ consumer_mutex };
+		periodic_update_impl ();
+
+		std::deque<value_type> result;
+
+		reader queues{ *this };
+		size_t misses = 0;
+		while (result.size () < max_count && !empty () && misses < queues->size ())
+		{
+			if (should_seek ())
+			{
+				seek_next (*queues);
+			}
+			release_assert (current_queue != nullptr);
+
+			if (auto request = current_queue->pop ())
+			{
+				--total_size;
+				++counter;
+				misses = 0;
+				result.emplace_back (std::move (*request), *position);
+			}
+			else
+			{
+				++misses;
+				skip = true;
+			}
+		}
+		return result;
+	}
+
+public:
+	using max_size_query_t = std::function<size_t (origin_type const &)>;
+	using priority_query_t = std::function<size_t (origin_type const &)>;
+
+	// Called from producer threads when a new origin is seen, must be thread safe
+	max_size_query_t max_size_query{ [] (auto const & origin) { debug_assert (false, "max_size_query callback empty"); return 0; } };
+	priority_query_t priority_query{ [] (auto const & origin) { debug_assert (false, "priority_query callback empty"); return 0; } };
+
+private:
+	bool push (entry & queue, Request request)
+	{
+		if (!queue.reserve ())
+		{
+			return false; // Dropped
+		}
+		// Counted before the request becomes visible, so consumers never decrement below zero
+		++total_size;
+		queue.push (std::move (request));
+		return true; // Added
+	}
+
+	/** Replaces the current snapshot, old snapshots are kept until no reader may still be using them */
+	void publish (queues_t updated)
+	{
+		debug_assert (!queues_mutex.try_lock ());
+		snapshots.push_back (std::make_unique<queues_t const> (std::move (updated)));
+		current.store (snapshots.back ().get ());
+		reclaim ();
+	}
+
+	void reclaim ()
+	{
+		debug_assert (!queues_mutex.try_lock ());
+		if (snapshots.size () < 2)
+		{
+			return;
+		}
+		// Readers started after the last publish only see the newest snapshot, so no readers at all means older ones are unused
+		bool const idle = std::all_of (readers.begin (), readers.end (), [] (auto const & slot) { return slot.count.load () == 0; });
+		if (idle)
+		{
+			snapshots.erase (snapshots.begin (), snapshots.end () - 1);
+		}
+	}
+
+	bool periodic_update_impl (std::chrono::milliseconds interval = std::chrono::milliseconds{ 1000 * 30 })
+	{
+		if (elapsed (last_update, interval))
+		{
+			last_update = std::chrono::steady_clock::now ();
+
+			std::lock_guard guard{ queues_mutex };
+			cleanup ();
+			update ();
+			reclaim ();
+
+			return true; // Updated
+		}
+		return false; // Not updated
+	}
+
+	bool should_seek () const
+	{
+		if (current_queue == nullptr || skip)
+		{
+			return true;
+		}
+		if (current_queue->count == 0)
+		{
+			return true;
+		}
+		// Allow up to `queue.priority` requests to be processed before moving to the next queue
+		if (counter >= current_queue->priority)
+		{
+			return true;
+		}
+		return false;
+	}
+
+	void seek_next (queues_t const & queues)
+	{
+		counter = 0;
+		skip = false;
+		// Continues after the last origin, which may have been cleaned up since
+		auto it = position ? queues.upper_bound (*position) : queues.begin ();
+		// Bounded to a single pass, requests counted in `total_size` may not be visible yet
+		for (size_t i = 0; i < queues.size (); ++i, ++it)
+		{
+			if (it == queues.end ())
+			{
+				it = queues.begin ();
+			}
+			position = it->first;
+			current_queue = it->second;
+			if (current_queue->count != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	void cleanup ()
+	{
+		debug_assert (!queues_mutex.try_lock ());
+
+		// Restart from the first origin
+		position.reset ();
+		current_queue.reset ();
+
+		// Only removing empty queues, no need to update the `total size` counter
+		auto updated = *snapshots.back ();
+		auto const erased = erase_if (updated, [] (auto const & entry) {
+			return entry.second->count == 0 && !entry.first.alive ();
+		});
+		if (erased > 0)
+		{
+			publish (std::move (updated));
+		}
+	}
+
+	void update ()
+	{
+		debug_assert (!queues_mutex.try_lock ());
+		for (auto & [source, queue] : *snapshots.back ())
+		{
+			queue->max_size = max_size_query (source);
+			queue->priority = priority_query (source);
+		}
+	}
+
+private:
+	// Published snapshots, the last one is current. Only modified under the mutex
+	std::deque<std::unique_ptr<queues_t const>> snapshots;
+	std::atomic<queues_t const *> current{ nullptr };
+	mutable std::array<reader_slot, reader_slots> readers;
+	std::mutex queues_mutex;
+	std::atomic<size_t> total_size{ 0 };
+
+	// Consumer side state
+	std::mutex consumer_mutex;
+	std::optional<origin_type> position;
+	std::shared_ptr<entry> current_queue;
+	size_t counter{ 0 };
+	bool skip{ false };
+	std::chrono::steady_clock::time_point last_update{ std::chrono::steady_clock::now () };
+
+public:
+	nano::container_info container_info () const
+	{
+		nano::container_info info;
+		info.put ("queues", queues_size ());
+		info.put ("total_size", size ());
+		return info;
+	}
+};
+}
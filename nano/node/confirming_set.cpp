@@ -1,6 +1,8 @@
+#include <nano/lib/locks.hpp>
 #include <nano/lib/thread_roles.hpp>
 #include <nano/node/confirming_set.hpp>
 #include <nano/secure/ledger.hpp>
+#include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/write_queue.hpp>
@@ -9,8 +11,14 @@ nano::confirming_set::confirming_set (confirming_set_config const & config_a, na
 	config{ config_a },
 	ledger{ ledger_a },
 	stats{ stats_a },
+	batch_size{ config.batch },
 	notification_workers{ 1, nano::thread_role::name::confirmation_height_notifications }
 {
+	if (config.planner_threads > 0)
+	{
+		planner_workers = std::make_unique<nano::thread_pool> (config.planner_threads, nano::thread_role::name::confirmation_height_planning);
+	}
+
 	batch_cemented.add ([this] (auto const & notification) {
 		for (auto const & [block, confirmation_root] : notification.cemented)
 		{
@@ -65,6 +73,10 @@ void nano::confirming_set::stop ()
 		thread.join ();
 	}
 	notification_workers.stop ();
+	if (planner_workers)
+	{
+		planner_workers->stop ();
+	}
 }
 
 bool nano::confirming_set::exists (nano::block_hash const & hash) const
@@ -123,7 +135,9 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 	std::deque<cemented_t> cemented;
 	std::deque<nano::block_hash> already;
 
-	auto batch = next_batch (256);
+	// Batches shrink while other writers, such as final vote generation, are waiting for the write lock
+	auto const requested = batch_size.next (ledger.store.write_queue.size ());
+	auto batch = next_batch (requested);
 
 	lock.unlock ();
 
@@ -161,11 +175,24 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 		}
 	};
 
+	// Dependency graphs are resolved before taking the write transaction, so that it only needs to apply the result
+	auto plans = plan (batch);
+	debug_assert (plans.size () == batch.size ());
+
+	std::chrono::steady_clock::time_point write_start;
 	{
 		auto transaction = ledger.tx_begin_write (nano::store::writer::confirmation_height);
-		for (auto const & hash : batch)
+		write_start = std::chrono::steady_clock::now ();
+		for (std::size_t index = 0; index < batch.size (); ++index)
 		{
-			do
+			auto const & hash = batch[index];
+			bool cemented_any = false;
+
+			if (!plans[index].empty ())
+			{
+				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cementing);
+			}
+			for (auto const & block : plans[index])
 			{
 				transaction.refresh_if_needed ();
 
@@ -178,29 +205,50 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 				// Issue notifications here, so that `cemented` set is not too large before we add more blocks
 				notify_maybe (transaction);
 
-				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cementing);
+				if (ledger.confirm_planned (transaction, *block))
+				{
+					stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cemented);
+					cemented.emplace_back (block, hash);
+					cemented_any = true;
+				}
+			}
 
-				auto added = ledger.confirm (transaction, hash, config.max_blocks);
-				if (!added.empty ())
+			// The plan is incomplete if it was truncated or the ledger changed after it was made, finish the remaining part directly
+			while (!ledger.confirmed.block_exists (transaction, hash))
+			{
+				transaction.refresh_if_needed ();
+
+				if (stopped)
 				{
-					// Confirming this block may implicitly confirm more
-					stats.add (nano::stat::type::confirming_set, nano::stat::detail::cemented, added.size ());
-					for (auto & block : added)
-					{
-						cemented.emplace_back (block, hash);
-					}
+					return;
 				}
-				else
+
+				notify_maybe (transaction);
+
+				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cementing);
+				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::plan_fallback);
+
+				auto added = ledger.confirm (transaction, hash, config.max_blocks);
+				debug_assert (!added.empty () || ledger.confirmed.block_exists (transaction, hash));
+				stats.add (nano::stat::type::confirming_set, nano::stat::detail::cemented, added.size ());
+				for (auto & block : added)
 				{
-					stats.inc (nano::stat::type::confirming_set, nano::stat::detail::already_cemented);
-					already.push_back (hash);
-					debug_assert (ledger.confirmed.block_exists (transaction, hash));
+					cemented.emplace_back (block, hash);
 				}
-			} while (!ledger.confirmed.block_exists (transaction, hash));
+				cemented_any = cemented_any || !added.empty ();
+			}
+
+			if (!cemented_any)
+			{
+				stats.inc (nano::stat::type::confirming_set, nano::stat::detail::already_cemented);
+				already.push_back (hash);
+			}
 
 			stats.inc (nano::stat::type::confirming_set, nano::stat::detail::cemented_hash);
 		}
 	}
+	// Hold time includes the commit
+	batch_size.update (requested, batch.size (), std::chrono::steady_clock::now () - write_start);
 
 	notify ();
 
@@ -208,12 +256,142 @@ void nano::confirming_set::run_batch (std::unique_lock<std::mutex> & lock)
 	release_assert (already.empty ());
 }
 
+/*
+ * confirming_set_plan_state
+ */
+
+namespace nano
+{
+/**
+ * Shared between the confirming set thread and planner tasks. Partitions are claimed through an atomic counter, so tasks that start late (or never) do not hold up the confirming set thread
+ * All partitions draw from a single budget of `max_blocks`, so a whole batch holds no more planned blocks in memory than a single `confirm` call would
+ */
+class confirming_set_plan_state final
+{
+public:
+	confirming_set_plan_state (nano::ledger & ledger_a, std::deque<nano::block_hash> const & batch_a, std::vector<std::vector<std::size_t>> partitions_a, std::size_t max_blocks_a, std::atomic<bool> const & stopped_a) :
+		ledger{ ledger_a },
+		batch{ batch_a },
+		partitions{ std::move (partitions_a) },
+		max_blocks{ max_blocks_a },
+		stopped{ stopped_a },
+		plans (batch_a.size ()),
+		budget{ max_blocks_a }
+	{
+	}
+
+	void run ()
+	{
+		for (auto index = next++; index < partitions.size (); index = next++)
+		{
+			std::unordered_set<nano::block_hash> planned;
+			auto transaction = ledger.tx_begin_read ();
+			for (auto const & batch_index : partitions[index])
+			{
+				// Hashes left without a plan are cemented directly under the write transaction
+				if (stopped)
+				{
+					break;
+				}
+				auto const limit = reserve ();
+				if (limit == 0)
+				{
+					break;
+				}
+				transaction.refresh_if_needed ();
+				plans[batch_index] = ledger.confirm_plan (transaction, batch[batch_index], planned, limit);
+				release (limit - plans[batch_index].size ());
+			}
+			{
+				nano::lock_guard<nano::mutex> guard{ mutex };
+				++completed;
+			}
+			condition.notify_all ();
+		}
+	}
+
+	void wait ()
+	{
+		nano::unique_lock<nano::mutex> lock{ mutex };
+		condition.wait (lock, [this] () { return completed == partitions.size (); });
+	}
+
+	nano::ledger & ledger;
+	std::deque<nano::block_hash> const & batch;
+	std::vector<std::vector<std::size_t>> const partitions;
+	std::size_t const max_blocks;
+	std::atomic<bool> const & stopped;
+	std::vector<std::deque<std::shared_ptr<nano::block>>> plans;
+
+private:
+	/** Takes up to an equal share of the budget per partition, the unused part is returned by `release` once the plan is made */
+	std::size_t reserve ()
+	{
+		auto const share = std::max<std::size_t> (max_blocks / partitions.size (), 1);
+		auto available = budget.load ();
+		while (!budget.compare_exchange_weak (available, available - std::min (share, available)))
+		{
+		}
+		return std::min (share, available);
+	}
+
+	void release (std::size_t unused)
+	{
+		budget += unused;
+	}
+
+	std::atomic<std::size_t> budget;
+	std::atomic<std::size_t> next{ 0 };
+	std::size_t completed{ 0 };
+	nano::mutex mutex;
+	nano::condition_variable condition;
+};
+}
+
+std::vector<std::deque<std::shared_ptr<nano::block>>> nano::confirming_set::plan (std::deque<nano::block_hash> const & batch)
+{
+	// Hashes from the same account always end up in the same partition, so their plans build on each other and do not overlap
+	std::size_t const max_partitions = (planner_workers && !stopped) ? planner_workers->get_num_threads () + 1 : 1;
+	std::vector<std::vector<std::size_t>> partitions (max_partitions);
+	{
+		auto transaction = ledger.tx_begin_read ();
+		for (std::size_t index = 0; index < batch.size (); ++index)
+		{
+			auto account = ledger.any.block_account (transaction, batch[index]).value_or (0);
+			partitions[std::hash<nano::account>{}(account) % max_partitions].push_back (index);
+		}
+	}
+	std::erase_if (partitions, [] (auto const & partition) { return partition.empty (); });
+
+	auto state = std::make_shared<nano::confirming_set_plan_state> (ledger, batch, std::move (partitions), config.max_blocks, stopped);
+	for (std::size_t i = 1; i < state->partitions.size (); ++i)
+	{
+		planner_workers->push_task ([state] () {
+			state->run ();
+		});
+	}
+	// Any partition not yet picked up by the pool is planned here
+	state->run ();
+	state->wait ();
+
+	for (auto const & entry : state->plans)
+	{
+		stats.add (nano::stat::type::confirming_set, nano::stat::detail::planned, entry.size ());
+	}
+	return std::move (state->plans);
+}
+
 nano::container_info nano::confirming_set::container_info () const
 {
 	std::lock_guard guard{ mutex };
 
 	nano::container_info info;
 	info.put ("set", set);
+	info.put ("batch_size", batch_size.size ());
 	info.add ("notification_workers", notification_workers.container_info ());
+	if (planner_workers)
+	{
+		info.add ("planner_workers", planner_workers->container_info ());
+	}
 	return info;
 }
@@ -3,13 +3,16 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/observer_set.hpp>
 #include <nano/lib/thread_pool.hpp>
+#include <nano/node/adaptive_batch.hpp>
 #include <nano/node/fwd.hpp>
 
+#include <algorithm>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 namespace nano
 {
@@ -22,6 +25,10 @@ public:
 	/** Maximum number of dependent blocks to be stored in memory during processing */
 	size_t max_blocks{ 128 * 1024 };
 	size_t max_queued_notifications{ 8 };
+	/** Number of threads resolving dependencies of a batch before it is written, the confirming set thread takes part as well */
+	unsigned planner_threads{ std::clamp (nano::hardware_concurrency () / 4, 1u, 4u) };
+	/** Number of hashes cemented under a single write transaction adapts to the time the write lock is held */
+	nano::adaptive_batch_config batch{ 16, 2048, std::chrono::milliseconds{ 50 } };
 };
 
 /**
@@ -69,11 +76,15 @@ private:
 	void run ();
 	void run_batch (std::unique_lock<std::mutex> &);
 	std::deque<nano::block_hash> next_batch (size_t max_count);
+	/** Resolves the blocks each hash of the batch will cement, independent accounts are resolved in parallel using read transactions */
+	std::vector<std::deque<std::shared_ptr<nano::block>>> plan (std::deque<nano::block_hash> const & batch);
 
 private:
 	std::unordered_set<nano::block_hash> set;
+	nano::adaptive_batch batch_size;
 
 	nano::thread_pool notification_workers;
+	std::unique_ptr<nano::thread_pool> planner_workers;
 
 	std::atomic<bool> stopped{ false };
 	mutable std::mutex mutex;
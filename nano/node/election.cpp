@@ -31,7 +31,7 @@ nano::election::election (nano::node & node_a, std::shared_ptr<nano::block> cons
 	root (block_a->root ()),
 	qualified_root (block_a->qualified_root ())
 {
-	last_votes.emplace (nano::account::null (), nano::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () });
+	record_vote (nano::account::null (), nano::vote_info{ std::chrono::steady_clock::now (), 0, block_a->hash () }, node.ledger.weight (nano::account::null ()));
 	last_blocks.emplace (block_a->hash (), block_a);
 }
 
@@ -237,13 +237,18 @@ void nano::election::broadcast_vote ()
 nano::vote_info nano::election::get_last_vote (nano::account const & account)
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
-	return last_votes[account];
+	if (auto existing = last_votes.find (account); existing != last_votes.end ())
+	{
+		return existing->second;
+	}
+	return {};
 }
 
 void nano::election::set_last_vote (nano::account const & account, nano::vote_info vote_info)
 {
+	auto weight = node.ledger.weight (account);
 	nano::lock_guard<nano::mutex> guard{ mutex };
-	last_votes[account] = vote_info;
+	record_vote (account, vote_info, weight);
 }
 
 nano::election_status nano::election::get_status () const
@@ -349,40 +354,84 @@ nano::tally_t nano::election::tally () const
 
 nano::tally_t nano::election::tally_impl () const
 {
-	std::unordered_map<nano::block_hash, nano::uint128_t> block_weights;
-	std::unordered_map<nano::block_hash, nano::uint128_t> final_weights_l;
-	for (auto const & [account, info] : last_votes)
-	{
-		auto rep_weight (node.ledger.weight (account));
-		block_weights[info.hash] += rep_weight;
-		if (info.timestamp == std::numeric_limits<uint64_t>::max ())
-		{
-			final_weights_l[info.hash] += rep_weight;
-		}
-	}
-	last_tally = block_weights;
+	// The running tally is kept up to date as votes arrive, only blocks known to this election need to be looked up
 	nano::tally_t result;
-	for (auto const & [hash, amount] : block_weights)
+	for (auto const & [hash, entry] : last_tally)
 	{
 		auto block (last_blocks.find (hash));
 		if (block != last_blocks.end ())
 		{
-			result.emplace (amount, block->second);
+			result.emplace (entry.weight, block->second);
 		}
 	}
-	// Calculate final votes sum for winner
-	if (!final_weights_l.empty () && !result.empty ())
+	// Final votes sum for winner
+	if (!result.empty ())
 	{
-		auto winner_hash (result.begin ()->second->hash ());
-		auto find_final (final_weights_l.find (winner_hash));
-		if (find_final != final_weights_l.end ())
+		auto find_final (last_tally.find (result.begin ()->second->hash ()));
+		if (find_final != last_tally.end () && find_final->second.final_voters > 0)
 		{
-			final_weight = find_final->second;
+			final_weight = find_final->second.final_weight;
 		}
 	}
 	return result;
 }
 
+void nano::election::record_vote (nano::account const & account, nano::vote_info const & info, nano::uint128_t weight)
+{
+	if (auto existing = last_votes.find (account); existing != last_votes.end ())
+	{
+		tally_remove (existing->second, last_vote_weights[account]);
+		existing->second = info;
+	}
+	else
+	{
+		last_votes.emplace (account, info);
+	}
+	last_vote_weights[account] = weight;
+	tally_add (info, weight);
+}
+
+auto nano::election::erase_vote (std::unordered_map<nano::account, nano::vote_info>::iterator existing) -> std::unordered_map<nano::account, nano::vote_info>::iterator
+{
+	auto weight = last_vote_weights.find (existing->first);
+	debug_assert (weight != last_vote_weights.end ());
+	tally_remove (existing->second, weight->second);
+	last_vote_weights.erase (weight);
+	return last_votes.erase (existing);
+}
+
+void nano::election::tally_add (nano::vote_info const & info, nano::uint128_t weight)
+{
+	auto & entry = last_tally[info.hash];
+	entry.weight += weight;
+	++entry.voters;
+	if (info.timestamp == std::numeric_limits<uint64_t>::max ())
+	{
+		entry.final_weight += weight;
+		++entry.final_voters;
+	}
+}
+
+void nano::election::tally_remove (nano::vote_info const & info, nano::uint128_t weight)
+{
+	auto existing = last_tally.find (info.hash);
+	release_assert (existing != last_tally.end ());
+	auto & entry = existing->second;
+	debug_assert (entry.weight >= weight && entry.voters > 0);
+	entry.weight -= weight;
+	--entry.voters;
+	if (info.timestamp == std::numeric_limits<uint64_t>::max ())
+	{
+		debug_assert (entry.final_weight >= weight && entry.final_voters > 0);
+		entry.final_weight -= weight;
+		--entry.final_voters;
+	}
+	if (entry.voters == 0)
+	{
+		last_tally.erase (existing);
+	}
+}
+
 void nano::election::confirm_if_quorum (nano::unique_lock<nano::mutex> & lock_a)
 {
 	debug_assert (lock_a.owns_lock ());
@@ -480,7 +529,7 @@ nano::vote_code nano::election::vote (nano::account const & rep, uint64_t timest
 		}
 	}
 
-	last_votes[rep] = { std::chrono::steady_clock::now (), timestamp_a, block_hash_a };
+	record_vote (rep, { std::chrono::steady_clock::now (), timestamp_a, block_hash_a }, weight);
 	if (vote_source_a != vote_source::cache)
 	{
 		live_vote_action (rep);
@@ -625,7 +674,10 @@ void nano::election::remove_votes (nano::block_hash const & hash_a)
 		auto list_generated_votes (node.history.votes (root, hash_a));
 		for (auto const & vote : list_generated_votes)
 		{
-			last_votes.erase (vote->account);
+			if (auto existing = last_votes.find (vote->account); existing != last_votes.end ())
+			{
+				erase_vote (existing);
+			}
 		}
 		// Clear votes cache
 		node.history.erase (root);
@@ -639,9 +691,10 @@ void nano::election::remove_block (nano::block_hash const & hash_a)
 	{
 		if (auto existing = last_blocks.find (hash_a); existing != last_blocks.end ())
 		{
-			erase_if (last_votes, [hash_a] (auto const & entry) {
-				return entry.second.hash == hash_a;
-			});
+			for (auto it = last_votes.begin (); it != last_votes.end ();)
+			{
+				it = it->second.hash == hash_a ? erase_vote (it) : std::next (it);
+			}
 
 			node.network.filter.clear (existing->second);
 			last_blocks.erase (hash_a);
@@ -657,7 +710,10 @@ bool nano::election::replace_by_weight (nano::unique_lock<nano::mutex> & lock_a,
 	// Sort existing blocks tally
 	std::vector<std::pair<nano::block_hash, nano::uint128_t>> sorted;
 	sorted.reserve (last_tally.size ());
-	std::copy (last_tally.begin (), last_tally.end (), std::back_inserter (sorted));
+	for (auto const & [hash, entry] : last_tally)
+	{
+		sorted.emplace_back (hash, entry.weight);
+	}
 	lock_a.unlock ();
 
 	// Sort in ascending order
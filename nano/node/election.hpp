@@ -161,6 +161,11 @@ private:
 	void broadcast_vote_locked (nano::unique_lock<nano::mutex> & lock);
 	void remove_votes (nano::block_hash const &);
 	void remove_block (nano::block_hash const &);
+	/** Records or replaces the vote of a representative, keeping the running tally up to date */
+	void record_vote (nano::account const &, nano::vote_info const &, nano::uint128_t weight);
+	std::unordered_map<nano::account, nano::vote_info>::iterator erase_vote (std::unordered_map<nano::account, nano::vote_info>::iterator);
+	void tally_add (nano::vote_info const &, nano::uint128_t weight);
+	void tally_remove (nano::vote_info const &, nano::uint128_t weight);
 	bool replace_by_weight (nano::unique_lock<nano::mutex> & lock_a, nano::block_hash const &);
 	std::chrono::milliseconds time_to_live () const;
 	/**
@@ -175,9 +180,21 @@ private:
 private:
 	std::unordered_map<nano::block_hash, std::shared_ptr<nano::block>> last_blocks;
 	std::unordered_map<nano::account, nano::vote_info> last_votes;
+	// Weight of each voter at the time its last vote was recorded
+	std::unordered_map<nano::account, nano::uint128_t> last_vote_weights;
 	std::atomic<bool> is_quorum{ false };
 	mutable nano::uint128_t final_weight{ 0 };
-	mutable std::unordered_map<nano::block_hash, nano::uint128_t> last_tally;
+
+	class block_tally final
+	{
+	public:
+		nano::uint128_t weight{ 0 };
+		nano::uint128_t final_weight{ 0 };
+		std::size_t voters{ 0 };
+		std::size_t final_voters{ 0 };
+	};
+	// Running tally per voted hash, updated by deltas as votes are recorded or removed
+	std::unordered_map<nano::block_hash, block_tally> last_tally;
 
 	nano::election_behavior const behavior_m;
 	std::chrono::steady_clock::time_point const election_start{ std::chrono::steady_clock::now () };
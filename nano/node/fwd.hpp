@@ -32,6 +32,7 @@ class recently_cemented_cache;
 class recently_confirmed_cache;
 class rep_crawler;
 class rep_tiers;
+class signature_checker;
 class stats;
 class vote_cache;
 class vote_generator;
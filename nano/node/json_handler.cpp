@@ -1,6 +1,7 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/config.hpp>
 #include <nano/lib/json_error_response.hpp>
+#include <nano/lib/json_writer.hpp>
 #include <nano/lib/stats_sinks.hpp>
 #include <nano/lib/timer.hpp>
 #include <nano/node/active_elections.hpp>
@@ -16,13 +17,16 @@
 #include <nano/secure/ledger.hpp>
 #include <nano/secure/ledger_set_any.hpp>
 #include <nano/secure/ledger_set_confirmed.hpp>
+#include <nano/secure/parallel_traversal.hpp>
 #include <nano/secure/transaction.hpp>
+#include <nano/store/value_view.hpp>
 
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <numeric>
 #include <vector>
 
 namespace
@@ -163,6 +167,28 @@ void nano::json_handler::response_errors ()
 	}
 }
 
+void nano::json_handler::response_fields (nano::json_writer & writer_a) const
+{
+	for (auto const & [key, value] : response_l)
+	{
+		// Only flat fields such as deprecation flags are put on the property tree by responses written directly
+		debug_assert (value.empty ());
+		writer_a.field (key, value.data ());
+	}
+}
+
+void nano::json_handler::response_body (std::string const & body_a)
+{
+	if (ec)
+	{
+		response_errors ();
+	}
+	else
+	{
+		response (body_a);
+	}
+}
+
 std::shared_ptr<nano::wallet> nano::json_handler::wallet_impl ()
 {
 	if (!ec)
@@ -1014,6 +1040,14 @@ void nano::json_handler::accounts_pending ()
 }
 
 void nano::json_handler::accounts_receivable ()
+{
+	// Responses can be large, built on a worker with a JSON writer instead of a property tree. The whole body is still buffered and sent as one response
+	node.workers.push_task (create_worker_task ([] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+		rpc_l->accounts_receivable_json ();
+	}));
+}
+
+void nano::json_handler::accounts_receivable_json ()
 {
 	auto count (count_optional_impl ());
 	auto threshold (threshold_optional_impl ());
@@ -1022,68 +1056,79 @@ void nano::json_handler::accounts_receivable ()
 	bool const include_only_confirmed = request.get<bool> ("include_only_confirmed", true);
 	bool const sorting = request.get<bool> ("sorting", false);
 	auto simple (threshold.is_zero () && !source && !sorting); // if simple, response is a list of hashes for each account
-	boost::property_tree::ptree pending;
+	std::string body;
+	nano::json_writer writer{ body };
+	writer.begin_object ();
+	writer.begin_object ("blocks");
 	auto transaction = node.ledger.tx_begin_read ();
 	for (auto & accounts : request.get_child ("accounts"))
 	{
 		auto account (account_impl (accounts.second.data ()));
 		if (!ec)
 		{
-			boost::property_tree::ptree peers_l;
-			for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end ()); i != n && nano::pending_key (i->first).account == account && peers_l.size () < count; ++i)
+			std::vector<std::pair<nano::block_hash, nano::pending_info>> entries;
+			for (auto i (node.store.pending.begin (transaction, nano::pending_key (account, 0))), n (node.store.pending.end ()); i != n && i.key_view<nano::store::pending_key_view> ().account () == account && entries.size () < count; ++i)
 			{
-				nano::pending_key const & key (i->first);
-				if (block_confirmed (node, transaction, key.hash, include_active, include_only_confirmed))
+				auto const hash = i.key_view<nano::store::pending_key_view> ().hash ();
+				if (block_confirmed (node, transaction, hash, include_active, include_only_confirmed))
 				{
 					if (simple)
 					{
-						boost::property_tree::ptree entry;
-						entry.put ("", key.hash.to_string ());
-						peers_l.push_back (std::make_pair ("", entry));
+						entries.emplace_back (hash, nano::pending_info{});
 					}
 					else
 					{
 						nano::pending_info const & info (i->second);
 						if (info.amount.number () >= threshold.number ())
 						{
-							if (source)
-							{
-								boost::property_tree::ptree pending_tree;
-								pending_tree.put ("amount", info.amount.number ().convert_to<std::string> ());
-								pending_tree.put ("source", info.source.to_account ());
-								peers_l.add_child (key.hash.to_string (), pending_tree);
-							}
-							else
-							{
-								peers_l.put (key.hash.to_string (), info.amount.number ().convert_to<std::string> ());
-							}
+							entries.emplace_back (hash, info);
 						}
 					}
 				}
 			}
 			if (sorting && !simple)
 			{
-				if (source)
+				std::stable_sort (entries.begin (), entries.end (), [] (auto const & entry1, auto const & entry2) {
+					return entry1.second.amount.number () > entry2.second.amount.number ();
+				});
+			}
+			if (!entries.empty ())
+			{
+				if (simple)
 				{
-					peers_l.sort ([] (auto const & child1, auto const & child2) -> bool {
-						return child1.second.template get<nano::uint128_t> ("amount") > child2.second.template get<nano::uint128_t> ("amount");
-					});
+					writer.begin_array (account.to_account ());
+					for (auto const & [hash, info] : entries)
+					{
+						writer.value (hash.to_string ());
+					}
+					writer.end_array ();
 				}
 				else
 				{
-					peers_l.sort ([] (auto const & child1, auto const & child2) -> bool {
-						return child1.second.template get<nano::uint128_t> ("") > child2.second.template get<nano::uint128_t> ("");
-					});
+					writer.begin_object (account.to_account ());
+					for (auto const & [hash, info] : entries)
+					{
+						if (source)
+						{
+							writer.begin_object (hash.to_string ());
+							writer.field ("amount", info.amount.number ().convert_to<std::string> ());
+							writer.field ("source", info.source.to_account ());
+							writer.end_object ();
+						}
+						else
+						{
+							writer.field (hash.to_string (), info.amount.number ().convert_to<std::string> ());
+						}
+					}
+					writer.end_object ();
 				}
 			}
-			if (!peers_l.empty ())
-			{
-				pending.add_child (account.to_account (), peers_l);
-			}
 		}
 	}
-	response_l.add_child ("blocks", pending);
-	response_errors ();
+	writer.end_object ();
+	response_fields (writer);
+	writer.end_object ();
+	response_body (body);
 }
 
 void nano::json_handler::active_difficulty ()
@@ -2224,6 +2269,14 @@ void nano::json_handler::database_txn_tracker ()
 }
 
 void nano::json_handler::delegators ()
+{
+	// Responses can be large, built on a worker with a JSON writer instead of a property tree. The whole body is still buffered and sent as one response
+	node.workers.push_task (create_worker_task ([] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+		rpc_l->delegators_json ();
+	}));
+}
+
+void nano::json_handler::delegators_json ()
 {
 	auto representative (account_impl ());
 	auto count (count_optional_impl (1024));
@@ -2236,27 +2289,46 @@ void nano::json_handler::delegators ()
 		start_account = account_impl (start_account_text.get ());
 	}
 
+	std::string body;
 	if (!ec)
 	{
-		auto transaction (node.ledger.tx_begin_read ());
-		boost::property_tree::ptree delegators;
-		for (auto i (node.store.account.begin (transaction, start_account.number () + 1)), n (node.store.account.end ()); i != n && delegators.size () < count; ++i)
-		{
-			nano::account_info const & info (i->second);
-			if (info.representative == representative)
+		// Each range collects up to `count` delegators, taking them in key order gives the same result as a sequential scan
+		auto ranges = parallel_traversal<nano::uint256_t> (node.traversal_workers, start_account.number () + 1, [this, &representative, &threshold, count] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
+			std::vector<std::pair<std::string, std::string>> delegators;
+			auto transaction (node.ledger.tx_begin_read ());
+			for (auto i (node.store.account.begin (transaction, begin)), n (!is_last ? node.store.account.begin (transaction, end) : node.store.account.end ()); i != n && delegators.size () < count; ++i)
 			{
-				if (info.balance.number () >= threshold.number ())
+				auto info = i.value_view<nano::store::account_info_view> ();
+				if (info.representative_equals (representative))
 				{
-					std::string balance;
-					nano::uint128_union (info.balance).encode_dec (balance);
-					nano::account const & delegator (i->first);
-					delegators.put (delegator.to_account (), balance);
+					auto const amount = info.balance ();
+					if (amount.number () >= threshold.number ())
+					{
+						std::string balance;
+						amount.encode_dec (balance);
+						nano::account const & delegator (i->first);
+						delegators.emplace_back (delegator.to_account (), std::move (balance));
+					}
 				}
 			}
+			return delegators;
+		});
+
+		nano::json_writer writer{ body };
+		writer.begin_object ();
+		writer.begin_object ("delegators");
+		for (auto const & delegators : ranges)
+		{
+			for (auto i (delegators.begin ()), n (delegators.end ()); i != n && writer.size () < count; ++i)
+			{
+				writer.field (i->first, i->second);
+			}
 		}
-		response_l.add_child ("delegators", delegators);
+		writer.end_object ();
+		response_fields (writer);
+		writer.end_object ();
 	}
-	response_errors ();
+	response_body (body);
 }
 
 void nano::json_handler::delegators_count ()
@@ -2264,16 +2336,19 @@ void nano::json_handler::delegators_count ()
 	auto account (account_impl ());
 	if (!ec)
 	{
-		uint64_t count (0);
-		auto transaction (node.ledger.tx_begin_read ());
-		for (auto i (node.store.account.begin (transaction)), n (node.store.account.end ()); i != n; ++i)
-		{
-			nano::account_info const & info (i->second);
-			if (info.representative == account)
+		auto ranges = parallel_traversal<nano::uint256_t> (node.traversal_workers, 0, [this, &account] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
+			uint64_t count (0);
+			auto transaction (node.ledger.tx_begin_read ());
+			for (auto i (node.store.account.begin (transaction, begin)), n (!is_last ? node.store.account.begin (transaction, end) : node.store.account.end ()); i != n; ++i)
 			{
-				++count;
+				if (i.value_view<nano::store::account_info_view> ().representative_equals (account))
+				{
+					++count;
+				}
 			}
-		}
+			return count;
+		});
+		auto const count = std::accumulate (ranges.begin (), ranges.end (), uint64_t{ 0 });
 		response_l.put ("count", std::to_string (count));
 	}
 	response_errors ();
@@ -2751,9 +2826,18 @@ void nano::json_handler::key_expand ()
 }
 
 void nano::json_handler::ledger ()
+{
+	// Responses can be large, built on a worker with a JSON writer instead of a property tree. The whole body is still buffered and sent as one response
+	node.workers.push_task (create_worker_task ([] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+		rpc_l->ledger_json ();
+	}));
+}
+
+void nano::json_handler::ledger_json ()
 {
 	auto count (count_optional_impl ());
 	auto threshold (threshold_optional_impl ());
+	std::string body;
 	if (!ec)
 	{
 		nano::account start{};
@@ -2776,45 +2860,54 @@ void nano::json_handler::ledger ()
 		bool const weight = request.get<bool> ("weight", false);
 		bool const pending = request.get<bool> ("pending", false);
 		bool const receivable = request.get<bool> ("receivable", pending);
-		boost::property_tree::ptree accounts;
+		nano::json_writer writer{ body };
+		writer.begin_object ();
+		writer.begin_object ("accounts");
 		auto transaction = node.ledger.tx_begin_read ();
+		auto write_account = [&] (nano::account const & account, nano::account_info const & info) {
+			std::string account_receivable_text;
+			if (receivable)
+			{
+				auto account_receivable = node.ledger.account_receivable (transaction, account);
+				if (info.balance.number () + account_receivable < threshold.number ())
+				{
+					return;
+				}
+				account_receivable_text = account_receivable.convert_to<std::string> ();
+			}
+			writer.begin_object (account.to_account ());
+			if (receivable)
+			{
+				writer.field ("pending", account_receivable_text);
+				writer.field ("receivable", account_receivable_text);
+			}
+			writer.field ("frontier", info.head.to_string ());
+			writer.field ("open_block", info.open_block.to_string ());
+			writer.field ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
+			std::string balance;
+			nano::uint128_union (info.balance).encode_dec (balance);
+			writer.field ("balance", balance);
+			writer.field ("modified_timestamp", std::to_string (info.modified));
+			writer.field ("block_count", std::to_string (info.block_count));
+			if (representative)
+			{
+				writer.field ("representative", info.representative.to_account ());
+			}
+			if (weight)
+			{
+				auto account_weight (node.ledger.weight_exact (transaction, account));
+				writer.field ("weight", account_weight.convert_to<std::string> ());
+			}
+			writer.end_object ();
+		};
 		if (!ec && !sorting) // Simple
 		{
-			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end ()); i != n && accounts.size () < count; ++i)
+			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end ()); i != n && writer.size () < count; ++i)
 			{
-				nano::account_info const & info (i->second);
-				if (info.modified >= modified_since && (receivable || info.balance.number () >= threshold.number ()))
+				auto const view = i.value_view<nano::store::account_info_view> ();
+				if (view.modified () >= modified_since && (receivable || view.balance ().number () >= threshold.number ()))
 				{
-					nano::account const & account (i->first);
-					boost::property_tree::ptree response_a;
-					if (receivable)
-					{
-						auto account_receivable = node.ledger.account_receivable (transaction, account);
-						if (info.balance.number () + account_receivable < threshold.number ())
-						{
-							continue;
-						}
-						response_a.put ("pending", account_receivable.convert_to<std::string> ());
-						response_a.put ("receivable", account_receivable.convert_to<std::string> ());
-					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					nano::uint128_union (info.balance).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
-					{
-						response_a.put ("representative", info.representative.to_account ());
-					}
-					if (weight)
-					{
-						auto account_weight (node.ledger.weight_exact (transaction, account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
-					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
+					write_account (i->first, i->second);
 				}
 			}
 		}
@@ -2823,57 +2916,29 @@ void nano::json_handler::ledger ()
 			std::vector<std::pair<nano::uint128_union, nano::account>> ledger_l;
 			for (auto i (node.store.account.begin (transaction, start)), n (node.store.account.end ()); i != n; ++i)
 			{
-				nano::account_info const & info (i->second);
-				nano::uint128_union balance (info.balance);
-				if (info.modified >= modified_since)
+				auto const view = i.value_view<nano::store::account_info_view> ();
+				if (view.modified () >= modified_since)
 				{
-					ledger_l.emplace_back (balance, i->first);
+					ledger_l.emplace_back (view.balance (), i->first);
 				}
 			}
 			std::sort (ledger_l.begin (), ledger_l.end ());
 			std::reverse (ledger_l.begin (), ledger_l.end ());
 			nano::account_info info;
-			for (auto i (ledger_l.begin ()), n (ledger_l.end ()); i != n && accounts.size () < count; ++i)
+			for (auto i (ledger_l.begin ()), n (ledger_l.end ()); i != n && writer.size () < count; ++i)
 			{
 				node.store.account.get (transaction, i->second, info);
 				if (receivable || info.balance.number () >= threshold.number ())
 				{
-					nano::account const & account (i->second);
-					boost::property_tree::ptree response_a;
-					if (receivable)
-					{
-						auto account_receivable = node.ledger.account_receivable (transaction, account);
-						if (info.balance.number () + account_receivable < threshold.number ())
-						{
-							continue;
-						}
-						response_a.put ("pending", account_receivable.convert_to<std::string> ());
-						response_a.put ("receivable", account_receivable.convert_to<std::string> ());
-					}
-					response_a.put ("frontier", info.head.to_string ());
-					response_a.put ("open_block", info.open_block.to_string ());
-					response_a.put ("representative_block", node.ledger.representative (transaction, info.head).to_string ());
-					std::string balance;
-					(i->first).encode_dec (balance);
-					response_a.put ("balance", balance);
-					response_a.put ("modified_timestamp", std::to_string (info.modified));
-					response_a.put ("block_count", std::to_string (info.block_count));
-					if (representative)
-					{
-						response_a.put ("representative", info.representative.to_account ());
-					}
-					if (weight)
-					{
-						auto account_weight (node.ledger.weight_exact (transaction, account));
-						response_a.put ("weight", account_weight.convert_to<std::string> ());
-					}
-					accounts.push_back (std::make_pair (account.to_account (), response_a));
+					write_account (i->second, info);
 				}
 			}
 		}
-		response_l.add_child ("accounts", accounts);
+		writer.end_object ();
+		response_fields (writer);
+		writer.end_object ();
 	}
-	response_errors ();
+	response_body (body);
 }
 
 void nano::json_handler::nano_to_raw ()
@@ -3180,6 +3245,9 @@ void nano::json_handler::process ()
 {
 	node.workers.push_task (create_worker_task ([] (std::shared_ptr<nano::json_handler> const & rpc_l) {
 		bool const is_async = rpc_l->request.get<bool> ("async", false);
+		// Only respond once the block is synced to disk, for sync strategies that do not sync every commit
+		// Only applies when processing synchronously, async requests respond before the block is processed
+		bool const is_durable = rpc_l->request.get<bool> ("durable", false);
 		auto block (rpc_l->block_impl (true));
 
 		// State blocks subtype check
@@ -3267,6 +3335,11 @@ void nano::json_handler::process ()
 						{
 							case nano::block_status::progress:
 							{
+								if (is_durable && rpc_l->node.store.flush ())
+								{
+									rpc_l->ec = nano::error_rpc::sync_failed;
+									break;
+								}
 								rpc_l->response_l.put ("hash", block->hash ().to_string ());
 								break;
 							}
@@ -4227,6 +4300,14 @@ void nano::json_handler::unchecked_keys ()
 }
 
 void nano::json_handler::unopened ()
+{
+	// Responses can be large, built on a worker with a JSON writer instead of a property tree. The whole body is still buffered and sent as one response
+	node.workers.push_task (create_worker_task ([] (std::shared_ptr<nano::json_handler> const & rpc_l) {
+		rpc_l->unopened_json ();
+	}));
+}
+
+void nano::json_handler::unopened_json ()
 {
 	auto count{ count_optional_impl () };
 	auto threshold{ threshold_optional_impl () };
@@ -4236,54 +4317,75 @@ void nano::json_handler::unopened ()
 	{
 		start = account_impl (account_text.get ());
 	}
+	std::string body;
 	if (!ec)
 	{
-		auto transaction = node.store.tx_begin_read ();
-		auto iterator = node.store.pending.begin (transaction, nano::pending_key (start, 0));
-		auto end = node.store.pending.end ();
-		nano::account current_account = start;
-		nano::uint128_t current_account_sum{ 0 };
-		boost::property_tree::ptree accounts;
-		while (iterator != end && accounts.size () < count)
-		{
-			nano::pending_key key{ iterator->first };
-			nano::account account{ key.account };
-			nano::pending_info info{ iterator->second };
-			if (node.store.account.exists (transaction, account))
-			{
-				if (account.number () == std::numeric_limits<nano::uint256_t>::max ())
+		// Ranges split the account space, so pending entries of one account are always summed by the same range
+		auto ranges = parallel_traversal<nano::uint256_t> (node.traversal_workers, start.number (), [this, &threshold, count] (nano::uint256_t const & begin, nano::uint256_t const & end, bool const is_last) {
+			std::vector<std::pair<nano::account, nano::uint128_t>> accounts;
+			auto add = [&accounts, &threshold] (nano::account const & account, nano::uint128_t const & sum) {
+				if (sum > 0 && sum >= threshold.number ())
+				{
+					accounts.emplace_back (account, sum);
+				}
+			};
+			auto transaction = node.store.tx_begin_read ();
+			auto iterator = node.store.pending.begin (transaction, nano::pending_key (begin, 0));
+			auto end_iterator = node.store.pending.end ();
+			nano::account current_account{ begin };
+			nano::uint128_t current_account_sum{ 0 };
+			while (iterator != end_iterator && accounts.size () < count)
+			{
+				auto const key = iterator.key_view<nano::store::pending_key_view> ();
+				nano::account account{ key.account () };
+				if (!is_last && account.number () >= end)
 				{
 					break;
 				}
-				// Skip existing accounts
-				iterator = node.store.pending.begin (transaction, nano::pending_key (account.number () + 1, 0));
-			}
-			else
-			{
-				if (account != current_account)
+				if (node.store.account.exists (transaction, account))
 				{
-					if (current_account_sum > 0)
+					if (account.number () == std::numeric_limits<nano::uint256_t>::max ())
 					{
-						if (current_account_sum >= threshold.number ())
-						{
-							accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
-						}
+						break;
+					}
+					// Skip existing accounts
+					iterator = node.store.pending.begin (transaction, nano::pending_key (account.number () + 1, 0));
+				}
+				else
+				{
+					if (account != current_account)
+					{
+						add (current_account, current_account_sum);
 						current_account_sum = 0;
+						current_account = account;
 					}
-					current_account = account;
+					current_account_sum += iterator.value_view<nano::store::pending_info_view> ().amount ().number ();
+					++iterator;
 				}
-				current_account_sum += info.amount.number ();
-				++iterator;
 			}
-		}
-		// last one after iterator reaches end
-		if (accounts.size () < count && current_account_sum > 0 && current_account_sum >= threshold.number ())
+			// last one after the range is exhausted
+			if (accounts.size () < count)
+			{
+				add (current_account, current_account_sum);
+			}
+			return accounts;
+		});
+
+		nano::json_writer writer{ body };
+		writer.begin_object ();
+		writer.begin_object ("accounts");
+		for (auto const & accounts : ranges)
 		{
-			accounts.put (current_account.to_account (), current_account_sum.convert_to<std::string> ());
+			for (auto i (accounts.begin ()), n (accounts.end ()); i != n && writer.size () < count; ++i)
+			{
+				writer.field (i->first.to_account (), i->second.convert_to<std::string> ());
+			}
 		}
-		response_l.add_child ("accounts", accounts);
+		writer.end_object ();
+		response_fields (writer);
+		writer.end_object ();
 	}
-	response_errors ();
+	response_body (body);
 }
 
 void nano::json_handler::uptime ()
@@ -21,6 +21,7 @@ namespace ipc
 {
 	class ipc_server;
 }
+class json_writer;
 class node;
 class node_rpc_config;
 
@@ -156,10 +157,18 @@ public:
 	boost::property_tree::ptree request;
 	std::function<void (std::string const &)> response;
 	void response_errors ();
+	/** Sends a complete response body written with json_writer, or the error if one occurred */
+	void response_body (std::string const &);
+	/** Writes the fields put on `response_l`, such as deprecation flags, into a response written with json_writer */
+	void response_fields (nano::json_writer &) const;
 	std::error_code ec;
 	std::string action;
 	boost::property_tree::ptree response_l;
 	std::shared_ptr<nano::wallet> wallet_impl ();
+	void accounts_receivable_json ();
+	void delegators_json ();
+	void ledger_json ();
+	void unopened_json ();
 	bool wallet_locked_impl (store::transaction const &, std::shared_ptr<nano::wallet> const &);
 	bool wallet_account_impl (store::transaction const &, std::shared_ptr<nano::wallet> const &, nano::account const &);
 	nano::account account_impl (std::string = "", std::error_code = nano::error_common::bad_account_number);
@@ -1865,13 +1865,17 @@ void nano::asc_pull_ack::operator() (nano::object_stream & obs) const
 
 void nano::asc_pull_ack::blocks_payload::serialize (nano::stream & stream) const
 {
-	debug_assert (blocks.size () <= max_blocks);
+	debug_assert (size () <= max_blocks);
 
 	for (auto & block : blocks)
 	{
 		debug_assert (block != nullptr);
 		nano::serialize_block (stream, *block);
 	}
+	if (!serialized_blocks.empty ())
+	{
+		nano::write (stream, serialized_blocks);
+	}
 	// For convenience, end with null block terminator
 	nano::serialize_block_type (stream, nano::block_type::not_a_block);
 }
@@ -1886,9 +1890,15 @@ void nano::asc_pull_ack::blocks_payload::deserialize (nano::stream & stream)
 	}
 }
 
+std::size_t nano::asc_pull_ack::blocks_payload::size () const
+{
+	return blocks.size () + serialized_count;
+}
+
 void nano::asc_pull_ack::blocks_payload::operator() (nano::object_stream & obs) const
 {
 	obs.write_range ("blocks", blocks);
+	obs.write ("serialized_count", serialized_count);
 }
 
 /*
@@ -686,8 +686,17 @@ public: // Payload definitions
 		void serialize (nano::stream &) const;
 		void deserialize (nano::stream &);
 
+		/** Number of blocks carried, either as objects or pre-serialized */
+		std::size_t size () const;
+
 	public: // Payload
 		std::deque<std::shared_ptr<nano::block>> blocks;
+		/**
+		 * Blocks already in wire serialization, sent after `blocks` as-is
+		 * Lets the bootstrap server copy blocks straight from the ledger without deserializing them, received messages only ever fill `blocks`
+		 */
+		std::vector<uint8_t> serialized_blocks;
+		std::size_t serialized_count{ 0 };
 
 	public: // Logging
 		void operator() (nano::object_stream &) const;
@@ -581,6 +581,7 @@ nano::container_info nano::network::container_info () const
 	info.add ("tcp_channels", tcp_channels.container_info ());
 	info.add ("syn_cookies", syn_cookies.container_info ());
 	info.add ("excluded_peers", excluded_peers.container_info ());
+	info.add ("receive_buffers", receive_buffers.container_info ());
 	return info;
 }
 
@@ -7,6 +7,7 @@
 #include <nano/node/peer_exclusion.hpp>
 #include <nano/node/transport/common.hpp>
 #include <nano/node/transport/fwd.hpp>
+#include <nano/node/transport/message_deserializer.hpp>
 #include <nano/node/transport/tcp_channels.hpp>
 
 #include <deque>
@@ -79,6 +80,9 @@ public:
 
 	size_t duplicate_filter_size{ 1024 * 1024 };
 	uint64_t duplicate_filter_cutoff{ 60 };
+
+	/** Maximum number of bytes of queued messages a socket coalesces into a single write */
+	size_t max_write_batch_bytes{ 128 * 1024 };
 };
 
 class network final
@@ -153,6 +157,7 @@ public:
 	boost::asio::ip::tcp::resolver resolver;
 	nano::peer_exclusion excluded_peers;
 	nano::network_filter filter;
+	nano::transport::receive_buffer_pool receive_buffers;
 	nano::transport::tcp_channels tcp_channels;
 	std::atomic<uint16_t> port{ 0 };
 
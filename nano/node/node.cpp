@@ -25,6 +25,7 @@
 #include <nano/node/scheduler/manual.hpp>
 #include <nano/node/scheduler/optimistic.hpp>
 #include <nano/node/scheduler/priority.hpp>
+#include <nano/node/signatures.hpp>
 #include <nano/node/telemetry.hpp>
 #include <nano/node/transport/tcp_listener.hpp>
 #include <nano/node/vote_generator.hpp>
@@ -80,6 +81,9 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	bootstrap_workers{ config.bootstrap_serving_threads, nano::thread_role::name::bootstrap_worker },
 	wallet_workers{ 1, nano::thread_role::name::wallet_worker },
 	election_workers{ 1, nano::thread_role::name::election_worker },
+	traversal_workers{ config.traversal_threads, nano::thread_role::name::db_parallel_traversal },
+	checker_impl{ std::make_unique<nano::signature_checker> (config.signature_checker_threads) },
+	checker{ *checker_impl },
 	flags (flags_a),
 	work (work_a),
 	distributed_work (*this),
@@ -129,7 +133,7 @@ nano::node::node (std::shared_ptr<boost::asio::io_context> io_ctx_a, std::filesy
 	vote_cache{ config.vote_cache, stats },
 	vote_router_impl{ std::make_unique<nano::vote_router> (vote_cache, active.recently_confirmed) },
 	vote_router{ *vote_router_impl },
-	vote_processor_impl{ std::make_unique<nano::vote_processor> (config.vote_processor, vote_router, observers, stats, flags, logger, online_reps, rep_crawler, ledger, network_params, rep_tiers) },
+	vote_processor_impl{ std::make_unique<nano::vote_processor> (config.vote_processor, vote_router, observers, stats, flags, logger, online_reps, rep_crawler, ledger, network_params, rep_tiers, checker) },
 	vote_processor{ *vote_processor_impl },
 	vote_cache_processor_impl{ std::make_unique<nano::vote_cache_processor> (config.vote_processor, vote_router, vote_cache, stats, logger) },
 	vote_cache_processor{ *vote_cache_processor_impl },
@@ -571,6 +575,11 @@ void nano::node::start ()
 
 	ongoing_online_weight_calculation_queue ();
 
+	if (config.rocksdb_config.enable && config.rocksdb_config.statistics)
+	{
+		ongoing_store_stats ();
+	}
+
 	bool tcp_enabled = false;
 	if (config.tcp_incoming_connections_max > 0 && !(flags.disable_bootstrap_listener && flags.disable_tcp_realtime))
 	{
@@ -653,6 +662,7 @@ void nano::node::stop ()
 	bootstrap_workers.stop ();
 	wallet_workers.stop ();
 	election_workers.stop ();
+	traversal_workers.stop ();
 	vote_router.stop ();
 	peer_history.stop ();
 	// Cancels ongoing work generation tasks, which may be blocking other threads
@@ -666,6 +676,7 @@ void nano::node::stop ()
 	aggregator.stop ();
 	vote_cache_processor.stop ();
 	vote_processor.stop ();
+	checker.stop ();
 	rep_tiers.stop ();
 	scheduler.stop ();
 	active.stop ();
@@ -691,6 +702,12 @@ void nano::node::stop ()
 	// Stop the IO runner last
 	runner.join ();
 	debug_assert (io_ctx_shared.use_count () == 1); // Node should be the last user of the io_context
+
+	// Nothing writes to the ledger anymore, persist its cache so the next startup does not need to rescan it
+	if (!flags.read_only && !flags.inactive_node)
+	{
+		ledger.save_cache ();
+	}
 }
 
 void nano::node::keepalive_preconfigured ()
@@ -1141,6 +1158,19 @@ void nano::node::ongoing_online_weight_calculation ()
 	ongoing_online_weight_calculation_queue ();
 }
 
+void nano::node::ongoing_store_stats ()
+{
+	store.export_stats (stats);
+
+	std::weak_ptr<nano::node> node_w (shared_from_this ());
+	workers.add_timed_task (std::chrono::steady_clock::now () + std::chrono::seconds (10), [node_w] () {
+		if (auto node_l = node_w.lock ())
+		{
+			node_l->ongoing_store_stats ();
+		}
+	});
+}
+
 void nano::node::process_confirmed (nano::election_status const & status_a, uint64_t iteration_a)
 {
 	auto hash (status_a.winner->hash ());
@@ -1288,6 +1318,8 @@ nano::container_info nano::node::container_info () const
 	info.add ("bootstrap_workers", bootstrap_workers.container_info ());
 	info.add ("wallet_workers", wallet_workers.container_info ());
 	info.add ("election_workers", election_workers.container_info ());
+	info.add ("traversal_workers", traversal_workers.container_info ());
+	info.add ("signature_checker", checker.container_info ());
 	info.add ("observers", observers.container_info ());
 	info.add ("wallets", wallets.container_info ());
 	info.add ("vote_processor", vote_processor.container_info ());
@@ -51,6 +51,7 @@ class vote_router;
 class work_pool;
 class peer_history;
 class port_mapping;
+class signature_checker;
 class thread_runner;
 
 namespace scheduler
@@ -132,6 +133,7 @@ public:
 	void do_rpc_callback (boost::asio::ip::tcp::resolver::iterator i_a, std::string const &, uint16_t, std::shared_ptr<std::string> const &, std::shared_ptr<std::string> const &, std::shared_ptr<boost::asio::ip::tcp::resolver> const &);
 	void ongoing_online_weight_calculation ();
 	void ongoing_online_weight_calculation_queue ();
+	void ongoing_store_stats ();
 	bool online () const;
 	bool init_error () const;
 	std::pair<uint64_t, std::unordered_map<nano::account, nano::uint128_t>> get_bootstrap_weights () const;
@@ -159,6 +161,9 @@ public:
 	nano::thread_pool bootstrap_workers;
 	nano::thread_pool wallet_workers;
 	nano::thread_pool election_workers;
+	nano::thread_pool traversal_workers;
+	std::unique_ptr<nano::signature_checker> checker_impl;
+	nano::signature_checker & checker;
 	nano::node_flags flags;
 	nano::work_pool & work;
 	nano::distributed_work_factory distributed_work;
@@ -0,0 +1,162 @@
+#include <nano/lib/container_info.hpp>
+#include <nano/lib/thread_pool.hpp>
+#include <nano/node/signatures.hpp>
+
+#include <algorithm>
+
+/*
+ * signature_check_set
+ */
+
+void nano::signature_check_set::add (nano::uint256_union const & message, nano::public_key const & key, nano::signature const & signature)
+{
+	messages.push_back (message);
+	keys.push_back (key);
+	signatures.push_back (signature);
+}
+
+std::size_t nano::signature_check_set::size () const
+{
+	return messages.size ();
+}
+
+bool nano::signature_check_set::empty () const
+{
+	return messages.empty ();
+}
+
+bool nano::signature_check_set::valid (std::size_t index) const
+{
+	debug_assert (verifications.size () == messages.size ());
+	return verifications[index] == 1;
+}
+
+/*
+ * signature_verification_state
+ */
+
+namespace nano
+{
+/**
+ * Shared between the calling thread and pool tasks. Batches are claimed through an atomic counter, so tasks that start late (or never) do not hold up the caller
+ */
+class signature_verification_state final
+{
+public:
+	signature_verification_state (nano::signature_check_set & check_set_a, std::size_t batches_a, std::size_t batch_size_a) :
+		check_set{ check_set_a },
+		batches{ batches_a },
+		batch_size{ batch_size_a }
+	{
+	}
+
+	void run ()
+	{
+		for (auto index = next++; index < batches; index = next++)
+		{
+			auto const start = index * batch_size;
+			auto const count = std::min (batch_size, check_set.size () - start);
+			nano::signature_checker::verify_batch (check_set, start, count);
+			{
+				nano::lock_guard<nano::mutex> guard{ mutex };
+				++completed;
+			}
+			condition.notify_all ();
+		}
+	}
+
+	void wait ()
+	{
+		nano::unique_lock<nano::mutex> lock{ mutex };
+		condition.wait (lock, [this] () { return completed == batches; });
+	}
+
+private:
+	nano::signature_check_set & check_set;
+	std::size_t const batches;
+	std::size_t const batch_size;
+	std::atomic<std::size_t> next{ 0 };
+	std::size_t completed{ 0 };
+	nano::mutex mutex;
+	nano::condition_variable condition;
+};
+}
+
+/*
+ * signature_checker
+ */
+
+nano::signature_checker::signature_checker (unsigned num_threads)
+{
+	if (num_threads > 0)
+	{
+		thread_pool = std::make_unique<nano::thread_pool> (num_threads, nano::thread_role::name::signature_checking);
+	}
+}
+
+nano::signature_checker::~signature_checker ()
+{
+	stop ();
+}
+
+void nano::signature_checker::stop ()
+{
+	stopped = true;
+	if (thread_pool)
+	{
+		thread_pool->stop ();
+	}
+}
+
+void nano::signature_checker::verify (nano::signature_check_set & check_set)
+{
+	auto const size = check_set.size ();
+	check_set.verifications.assign (size, 0);
+	if (size == 0)
+	{
+		return;
+	}
+
+	// One batch per available thread (including the calling one), but never smaller than what batch verification needs to pay off
+	std::size_t const max_batches = (thread_pool && !stopped) ? thread_pool->get_num_threads () + 1 : 1;
+	auto const batches = std::clamp<std::size_t> (size / min_batch_size, 1, max_batches);
+	auto const batch_size = (size + batches - 1) / batches;
+
+	auto state = std::make_shared<nano::signature_verification_state> (check_set, batches, batch_size);
+	for (std::size_t i = 1; i < batches; ++i)
+	{
+		thread_pool->push_task ([state] () {
+			state->run ();
+		});
+	}
+	// Any batch not yet picked up by the pool is verified here
+	state->run ();
+	state->wait ();
+}
+
+void nano::signature_checker::verify_batch (nano::signature_check_set & check_set, std::size_t start, std::size_t count)
+{
+	debug_assert (start + count <= check_set.size ());
+
+	std::vector<unsigned char const *> messages (count);
+	std::vector<std::size_t> lengths (count, sizeof (nano::uint256_union));
+	std::vector<unsigned char const *> keys (count);
+	std::vector<unsigned char const *> signatures (count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		messages[i] = check_set.messages[start + i].bytes.data ();
+		keys[i] = check_set.keys[start + i].bytes.data ();
+		signatures[i] = check_set.signatures[start + i].bytes.data ();
+	}
+	nano::validate_message_batch (messages.data (), lengths.data (), keys.data (), signatures.data (), count, check_set.verifications.data () + start);
+}
+
+nano::container_info nano::signature_checker::container_info () const
+{
+	nano::container_info info;
+	if (thread_pool)
+	{
+		info.add ("thread_pool", thread_pool->container_info ());
+	}
+	return info;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/node/fwd.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nano
+{
+class thread_pool;
+
+/**
+ * Set of (message, public key, signature) entries to be verified together by the signature checker
+ * Entries are copied into the set, so the originating objects do not need to outlive it
+ */
+class signature_check_set final
+{
+public:
+	void add (nano::uint256_union const & message, nano::public_key const & key, nano::signature const & signature);
+	std::size_t size () const;
+	bool empty () const;
+	/** Result for entry at `index`, only meaningful after the set went through `signature_checker::verify` */
+	bool valid (std::size_t index) const;
+
+private:
+	std::vector<nano::uint256_union> messages;
+	std::vector<nano::public_key> keys;
+	std::vector<nano::signature> signatures;
+	std::vector<int> verifications;
+
+	friend class signature_checker;
+};
+
+/**
+ * Verifies ed25519 signatures using batch verification, splitting large sets across a dedicated thread pool
+ */
+class signature_checker final
+{
+public:
+	explicit signature_checker (unsigned num_threads);
+	~signature_checker ();
+
+	/** Verifies all entries in the set. The calling thread takes part in verification and this call blocks until every entry has been checked */
+	void verify (nano::signature_check_set &);
+	void stop ();
+
+	nano::container_info container_info () const;
+
+	/** Smaller sets are verified on the calling thread only, splitting them further does not pay off */
+	static std::size_t constexpr min_batch_size = 64;
+
+private:
+	static void verify_batch (nano::signature_check_set &, std::size_t start, std::size_t count);
+
+private:
+	std::unique_ptr<nano::thread_pool> thread_pool;
+	std::atomic<bool> stopped{ false };
+
+	friend class signature_verification_state;
+};
+}
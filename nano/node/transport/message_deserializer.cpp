@@ -2,17 +2,17 @@
 #include <nano/node/node.hpp>
 #include <nano/node/transport/message_deserializer.hpp>
 
-nano::transport::message_deserializer::message_deserializer (nano::network_constants const & network_constants_a, nano::network_filter & network_filter_a, nano::block_uniquer & block_uniquer_a, nano::vote_uniquer & vote_uniquer_a,
+nano::transport::message_deserializer::message_deserializer (nano::network_constants const & network_constants_a, nano::network_filter & network_filter_a, nano::block_uniquer & block_uniquer_a, nano::vote_uniquer & vote_uniquer_a, nano::transport::receive_buffer_pool & buffer_pool_a,
 read_query read_op) :
-	read_buffer{ std::make_shared<std::vector<uint8_t>> () },
+	header_buffer{ std::make_shared<std::vector<uint8_t>> (HEADER_SIZE) },
 	network_constants_m{ network_constants_a },
 	network_filter_m{ network_filter_a },
 	block_uniquer_m{ block_uniquer_a },
 	vote_uniquer_m{ vote_uniquer_a },
+	buffer_pool_m{ buffer_pool_a },
 	read_op{ std::move (read_op) }
 {
 	debug_assert (this->read_op);
-	read_buffer->resize (MAX_MESSAGE_SIZE);
 }
 
 void nano::transport::message_deserializer::read (const nano::transport::message_deserializer::callback_type && callback)
@@ -22,7 +22,7 @@ void nano::transport::message_deserializer::read (const nano::transport::message
 
 	status = parse_status::none;
 
-	read_op (read_buffer, HEADER_SIZE, [this_l = shared_from_this (), callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
+	read_op (header_buffer, HEADER_SIZE, [this_l = shared_from_this (), callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
 		if (ec)
 		{
 			callback (ec, nullptr);
@@ -39,7 +39,7 @@ void nano::transport::message_deserializer::read (const nano::transport::message
 
 void nano::transport::message_deserializer::received_header (const nano::transport::message_deserializer::callback_type && callback)
 {
-	nano::bufferstream stream{ read_buffer->data (), HEADER_SIZE };
+	nano::bufferstream stream{ header_buffer->data (), HEADER_SIZE };
 	auto error = false;
 	nano::message_header header{ error, stream };
 	if (error)
@@ -74,35 +74,42 @@ void nano::transport::message_deserializer::received_header (const nano::transpo
 		callback (boost::asio::error::fault, nullptr);
 		return;
 	}
-	debug_assert (payload_size <= read_buffer->capacity ());
 
 	if (payload_size == 0)
 	{
 		// Payload size will be 0 for `bulk_push` & `telemetry_req` message type
-		received_message (header, 0, std::move (callback));
+		received_message (header, nullptr, 0, std::move (callback));
 	}
 	else
 	{
 		debug_assert (read_op);
-		read_op (read_buffer, payload_size, [this_l = shared_from_this (), payload_size, header, callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
+		auto payload = buffer_pool_m.acquire (payload_size);
+		read_op (payload, payload_size, [this_l = shared_from_this (), payload, payload_size, header, callback = std::move (callback)] (boost::system::error_code const & ec, std::size_t size_a) {
 			if (ec)
 			{
+				this_l->buffer_pool_m.release (payload);
 				callback (ec, nullptr);
 				return;
 			}
 			if (size_a != payload_size)
 			{
+				this_l->buffer_pool_m.release (payload);
 				callback (boost::asio::error::fault, nullptr);
 				return;
 			}
-			this_l->received_message (header, size_a, std::move (callback));
+			this_l->received_message (header, payload, size_a, std::move (callback));
 		});
 	}
 }
 
-void nano::transport::message_deserializer::received_message (nano::message_header header, std::size_t payload_size, const nano::transport::message_deserializer::callback_type && callback)
+void nano::transport::message_deserializer::received_message (nano::message_header header, nano::transport::receive_buffer_pool::buffer_t payload, std::size_t payload_size, const nano::transport::message_deserializer::callback_type && callback)
 {
-	auto message = deserialize (header, payload_size);
+	auto message = deserialize (header, payload, payload_size);
+	// Deserialized messages do not reference the payload, it can be reused before the message is handled
+	if (payload)
+	{
+		buffer_pool_m.release (std::move (payload));
+	}
 	if (message)
 	{
 		debug_assert (status == parse_status::none);
@@ -116,10 +123,11 @@ void nano::transport::message_deserializer::received_message (nano::message_head
 	}
 }
 
-std::unique_ptr<nano::message> nano::transport::message_deserializer::deserialize (nano::message_header header, std::size_t payload_size)
+std::unique_ptr<nano::message> nano::transport::message_deserializer::deserialize (nano::message_header header, nano::transport::receive_buffer_pool::buffer_t const & payload, std::size_t payload_size)
 {
 	release_assert (payload_size <= MAX_MESSAGE_SIZE);
-	nano::bufferstream stream{ read_buffer->data (), payload_size };
+	debug_assert (payload_size == 0 || (payload && payload->size () >= payload_size));
+	nano::bufferstream stream{ payload ? payload->data () : nullptr, payload_size };
 	switch (header.type)
 	{
 		case nano::message_type::keepalive:
@@ -130,7 +138,7 @@ std::unique_ptr<nano::message> nano::transport::message_deserializer::deserializ
 		{
 			// Early filtering to not waste time deserializing duplicates
 			nano::uint128_t digest;
-			if (!network_filter_m.apply (read_buffer->data (), payload_size, &digest))
+			if (!network_filter_m.apply (payload->data (), payload_size, &digest))
 			{
 				return deserialize_publish (stream, header, digest);
 			}
@@ -148,7 +156,7 @@ std::unique_ptr<nano::message> nano::transport::message_deserializer::deserializ
 		{
 			// Early filtering to not waste time deserializing duplicates
 			nano::uint128_t digest;
-			if (!network_filter_m.apply (read_buffer->data (), payload_size, &digest))
+			if (!network_filter_m.apply (payload->data (), payload_size, &digest))
 			{
 				return deserialize_confirm_ack (stream, header, digest);
 			}
@@ -382,6 +390,22 @@ std::unique_ptr<nano::asc_pull_ack> nano::transport::message_deserializer::deser
 	// Intentionally not checking if at the end of stream, because these messages support backwards/forwards compatibility
 	if (!error)
 	{
+		if (auto const * blocks = std::get_if<nano::asc_pull_ack::blocks_payload> (&incoming->payload))
+		{
+			// Validate work of the whole payload at once, bootstrap responses carry up to max_blocks blocks
+			std::vector<nano::block const *> pointers;
+			pointers.reserve (blocks->blocks.size ());
+			for (auto const & block : blocks->blocks)
+			{
+				release_assert (block);
+				pointers.push_back (block.get ());
+			}
+			if (network_constants_m.work.validate_batch (pointers))
+			{
+				status = parse_status::insufficient_work;
+				return {};
+			}
+		}
 		return incoming;
 	}
 	else
@@ -391,6 +415,63 @@ std::unique_ptr<nano::asc_pull_ack> nano::transport::message_deserializer::deser
 	return {};
 }
 
+/*
+ * receive_buffer_pool
+ */
+
+nano::transport::receive_buffer_pool::receive_buffer_pool (std::size_t max_pooled_a) :
+	max_pooled{ max_pooled_a }
+{
+}
+
+auto nano::transport::receive_buffer_pool::acquire (std::size_t size) -> buffer_t
+{
+	buffer_t result;
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		if (!buffers.empty ())
+		{
+			result = std::move (buffers.back ());
+			buffers.pop_back ();
+		}
+	}
+	if (!result)
+	{
+		result = std::make_shared<std::vector<uint8_t>> ();
+		// Reserve the largest possible message up front so a pooled buffer never needs to grow
+		result->reserve (buffer_capacity);
+	}
+	if (result->size () < size)
+	{
+		result->resize (size);
+	}
+	return result;
+}
+
+void nano::transport::receive_buffer_pool::release (buffer_t buffer)
+{
+	debug_assert (buffer);
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	if (buffers.size () < max_pooled)
+	{
+		buffers.push_back (std::move (buffer));
+	}
+}
+
+std::size_t nano::transport::receive_buffer_pool::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return buffers.size ();
+}
+
+nano::container_info nano::transport::receive_buffer_pool::container_info () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	nano::container_info info;
+	info.put ("buffers", buffers.size (), buffer_capacity);
+	return info;
+}
+
 /*
  *
  */
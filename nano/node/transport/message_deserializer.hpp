@@ -1,5 +1,7 @@
 #pragma once
 
+#include <nano/lib/container_info.hpp>
+#include <nano/lib/locks.hpp>
 #include <nano/lib/network_filter.hpp>
 #include <nano/node/common.hpp>
 #include <nano/node/messages.hpp>
@@ -37,6 +39,33 @@ namespace transport
 		message_size_too_big,
 	};
 
+	/**
+	 * Shared pool of payload buffers. Deserializers only hold a buffer while a payload is being read, so idle connections do not each keep a full size buffer allocated.
+	 */
+	class receive_buffer_pool final
+	{
+	public:
+		using buffer_t = std::shared_ptr<std::vector<uint8_t>>;
+
+		/** Large enough for any message payload */
+		static constexpr std::size_t buffer_capacity = 1024 * 65;
+
+		explicit receive_buffer_pool (std::size_t max_pooled = 256);
+
+		/** Returns a buffer with at least `size` bytes, reusing a pooled one if available */
+		buffer_t acquire (std::size_t size);
+		/** Returns the buffer to the pool, unless the pool is already full */
+		void release (buffer_t);
+
+		std::size_t size () const;
+		nano::container_info container_info () const;
+
+	private:
+		std::size_t const max_pooled;
+		std::vector<buffer_t> buffers;
+		mutable nano::mutex mutex;
+	};
+
 	class message_deserializer : public std::enable_shared_from_this<nano::transport::message_deserializer>
 	{
 	public:
@@ -46,7 +75,7 @@ namespace transport
 
 		using read_query = std::function<void (std::shared_ptr<std::vector<uint8_t>> const &, size_t, std::function<void (boost::system::error_code const &, std::size_t)>)>;
 
-		message_deserializer (nano::network_constants const &, nano::network_filter &, nano::block_uniquer &, nano::vote_uniquer &, read_query read_op);
+		message_deserializer (nano::network_constants const &, nano::network_filter &, nano::block_uniquer &, nano::vote_uniquer &, nano::transport::receive_buffer_pool &, read_query read_op);
 
 		/*
 		 * Asynchronously read next message from the channel_read_fn.
@@ -59,13 +88,13 @@ namespace transport
 
 	private:
 		void received_header (callback_type const && callback);
-		void received_message (nano::message_header header, std::size_t payload_size, callback_type const && callback);
+		void received_message (nano::message_header header, nano::transport::receive_buffer_pool::buffer_t payload, std::size_t payload_size, callback_type const && callback);
 
 		/*
-		 * Deserializes message using data in `read_buffer`.
+		 * Deserializes message using data in `payload`.
 		 * @return If successful returns non-null message, otherwise sets `status` to error appropriate code and returns nullptr
 		 */
-		std::unique_ptr<nano::message> deserialize (nano::message_header header, std::size_t payload_size);
+		std::unique_ptr<nano::message> deserialize (nano::message_header header, nano::transport::receive_buffer_pool::buffer_t const & payload, std::size_t payload_size);
 		std::unique_ptr<nano::keepalive> deserialize_keepalive (nano::stream &, nano::message_header const &);
 		std::unique_ptr<nano::publish> deserialize_publish (nano::stream &, nano::message_header const &, nano::network_filter::digest_t const & digest);
 		std::unique_ptr<nano::confirm_req> deserialize_confirm_req (nano::stream &, nano::message_header const &);
@@ -81,17 +110,19 @@ namespace transport
 		std::unique_ptr<nano::asc_pull_ack> deserialize_asc_pull_ack (nano::stream &, nano::message_header const &);
 
 	private:
-		std::shared_ptr<std::vector<uint8_t>> read_buffer;
+		/** Only large enough for the header, payloads are read into buffers borrowed from the pool */
+		std::shared_ptr<std::vector<uint8_t>> header_buffer;
 
 	private: // Constants
 		static constexpr std::size_t HEADER_SIZE = 8;
-		static constexpr std::size_t MAX_MESSAGE_SIZE = 1024 * 65;
+		static constexpr std::size_t MAX_MESSAGE_SIZE = receive_buffer_pool::buffer_capacity;
 
 	private: // Dependencies
 		nano::network_constants const & network_constants_m;
 		nano::network_filter & network_filter_m;
 		nano::block_uniquer & block_uniquer_m;
 		nano::vote_uniquer & vote_uniquer_m;
+		nano::transport::receive_buffer_pool & buffer_pool_m;
 		read_query read_op;
 	};
 
@@ -186,17 +186,31 @@ void nano::transport::tcp_socket::write_queued_messages ()
 		return;
 	}
 
-	auto next = send_queue.pop ();
-	if (!next)
+	auto node_l = node_w.lock ();
+	if (!node_l)
+	{
+		return;
+	}
+
+	// Everything queued so far is written with a single scatter/gather write, up to the configured size
+	auto batch = send_queue.pop_batch (node_l->config.network.max_write_batch_bytes);
+	if (batch.empty ())
 	{
 		return;
 	}
 
+	std::vector<boost::asio::const_buffer> buffers;
+	buffers.reserve (batch.size ());
+	for (auto const & entry : batch)
+	{
+		buffers.insert (buffers.end (), entry.buffer.begin (), entry.buffer.end ());
+	}
+
 	set_default_timeout ();
 
 	write_in_progress = true;
-	nano::async_write (raw_socket, next->buffer,
-	boost::asio::bind_executor (strand, [this_l = shared_from_this (), next /* `next` object keeps buffer in scope */] (boost::system::error_code ec, std::size_t size) {
+	nano::unsafe_async_write (raw_socket, buffers,
+	boost::asio::bind_executor (strand, [this_l = shared_from_this (), batch = std::move (batch) /* `batch` keeps buffers in scope */] (boost::system::error_code ec, std::size_t size) {
 		debug_assert (this_l->strand.running_in_this_thread ());
 
 		auto node_l = this_l->node_w.lock ();
@@ -214,12 +228,16 @@ void nano::transport::tcp_socket::write_queued_messages ()
 		else
 		{
 			node_l->stats.add (nano::stat::type::traffic_tcp, nano::stat::detail::all, nano::stat::dir::out, size, /* aggregate all */ true);
+			node_l->stats.inc (nano::stat::type::tcp, nano::stat::detail::tcp_write_batch, nano::stat::dir::out);
 			this_l->set_last_completion ();
 		}
 
-		if (next->callback)
+		for (auto const & entry : batch)
 		{
-			next->callback (ec, size);
+			if (entry.callback)
+			{
+				entry.callback (ec, ec ? 0 : entry.buffer.size ());
+			}
 		}
 
 		if (!ec)
@@ -436,32 +454,31 @@ bool nano::transport::socket_queue::insert (const buffer_t & buffer, callback_t
 	return false; // Not queued
 }
 
-std::optional<nano::transport::socket_queue::entry> nano::transport::socket_queue::pop ()
+auto nano::transport::socket_queue::pop_batch (std::size_t max_bytes) -> std::vector<entry>
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
 
-	auto try_pop = [this] (nano::transport::traffic_type type) -> std::optional<entry> {
+	std::vector<entry> result;
+	std::size_t total = 0;
+
+	// TODO: This is a very basic prioritization, implement something more advanced and configurable
+	// A lower priority queue is only drained once the higher ones are empty
+	for (auto type : { nano::transport::traffic_type::generic, nano::transport::traffic_type::bootstrap })
+	{
 		auto & que = queues[type];
-		if (!que.empty ())
+		while (!que.empty ())
 		{
-			auto item = que.front ();
+			auto const size = que.front ().buffer.size ();
+			if (!result.empty () && total + size > max_bytes)
+			{
+				return result;
+			}
+			total += size;
+			result.push_back (std::move (que.front ()));
 			que.pop ();
-			return item;
 		}
-		return std::nullopt;
-	};
-
-	// TODO: This is a very basic prioritization, implement something more advanced and configurable
-	if (auto item = try_pop (nano::transport::traffic_type::generic))
-	{
-		return item;
 	}
-	if (auto item = try_pop (nano::transport::traffic_type::bootstrap))
-	{
-		return item;
-	}
-
-	return std::nullopt;
+	return result;
 }
 
 void nano::transport::socket_queue::clear ()
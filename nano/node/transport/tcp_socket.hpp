@@ -12,7 +12,6 @@
 #include <chrono>
 #include <map>
 #include <memory>
-#include <optional>
 #include <queue>
 #include <unordered_map>
 #include <vector>
@@ -45,7 +44,8 @@ public:
 	explicit socket_queue (std::size_t max_size);
 
 	bool insert (buffer_t const &, callback_t, nano::transport::traffic_type);
-	std::optional<entry> pop ();
+	/** Pops entries in priority order until `max_bytes` would be exceeded, always returns at least one entry if the queue is not empty */
+	std::vector<entry> pop_batch (std::size_t max_bytes);
 	void clear ();
 	std::size_t size (nano::transport::traffic_type) const;
 	bool empty () const;
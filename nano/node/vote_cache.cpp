@@ -7,7 +7,7 @@
 #include <ranges>
 
 /*
- * entvote_cache_entryry
+ * vote_cache_entry
  */
 
 nano::vote_cache_entry::vote_cache_entry (const nano::block_hash & hash) :
@@ -32,7 +32,10 @@ bool nano::vote_cache_entry::vote_impl (std::shared_ptr<nano::vote> const & vote
 {
 	auto const representative = vote->account;
 
-	if (auto existing = voters.find (representative); existing != voters.end ())
+	auto existing = std::find_if (voters.begin (), voters.end (), [&representative] (auto const & voter) {
+		return voter.representative == representative;
+	});
+	if (existing != voters.end ())
 	{
 		// We already have a vote from this rep
 		// Update timestamp if newer but tally remains unchanged as we already counted this rep weight
@@ -40,15 +43,21 @@ bool nano::vote_cache_entry::vote_impl (std::shared_ptr<nano::vote> const & vote
 		if (vote->timestamp () > existing->vote->timestamp ())
 		{
 			bool was_final = existing->vote->is_final ();
-			voters.modify (existing, [&vote, &rep_weight] (auto & existing) {
-				existing.vote = vote;
-				existing.weight = rep_weight;
-			});
+			existing->vote = vote;
+			existing->weight = rep_weight;
 			return !was_final && vote->is_final (); // Tally changed only if the vote became final
 		}
 	}
 	else
 	{
+		// First voter with the lowest weight, same as the oldest one in a weight ordered index
+		auto lowest_weight = [this] () {
+			release_assert (!voters.empty ());
+			return std::min_element (voters.begin (), voters.end (), [] (auto const & a, auto const & b) {
+				return a.weight < b.weight;
+			});
+		};
+
 		auto should_add = [&, this] () {
 			if (voters.size () < max_voters)
 			{
@@ -56,22 +65,19 @@ bool nano::vote_cache_entry::vote_impl (std::shared_ptr<nano::vote> const & vote
 			}
 			else
 			{
-				release_assert (!voters.empty ());
-				auto const & min_weight = voters.get<tag_weight> ().begin ()->weight;
-				return rep_weight > min_weight;
+				return rep_weight > lowest_weight ()->weight;
 			}
 		};
 
 		// Vote from a new representative, add it to the list and update tally
 		if (should_add ())
 		{
-			voters.insert ({ representative, rep_weight, vote });
+			voters.push_back ({ representative, rep_weight, vote });
 
 			// If we have reached the maximum number of voters, remove the lowest weight voter
 			if (voters.size () >= max_voters)
 			{
-				release_assert (!voters.empty ());
-				voters.get<tag_weight> ().erase (voters.get<tag_weight> ().begin ());
+				voters.erase (lowest_weight ());
 			}
 
 			return true;
@@ -156,26 +162,64 @@ void nano::vote_cache::insert_impl (std::shared_ptr<nano::vote> const & vote, na
 	{
 		stats.inc (nano::stat::type::vote_cache, nano::stat::detail::update);
 
-		cache.modify (existing, [this, &vote, &rep_weight] (entry & ent) {
-			ent.vote (vote, rep_weight, config.max_voters);
-		});
+		if (existing->second.value.vote (vote, rep_weight, config.max_voters))
+		{
+			push_tally (existing->second.value);
+		}
 	}
 	else
 	{
 		stats.inc (nano::stat::type::vote_cache, nano::stat::detail::insert);
 
-		entry cache_entry{ hash };
-		cache_entry.vote (vote, rep_weight, config.max_voters);
-		cache.insert (cache_entry);
+		auto const sequence = next_sequence++;
+		auto [it, inserted] = cache.emplace (hash, cache_entry{ entry{ hash }, sequence, 0 });
+		debug_assert (inserted);
+		it->second.value.vote (vote, rep_weight, config.max_voters);
+		insertion_order.emplace_back (hash, sequence);
+		push_tally (it->second.value);
 
 		// Remove the oldest entry if we have reached the capacity limit
 		if (cache.size () > config.max_size)
 		{
-			cache.get<tag_sequenced> ().pop_front ();
+			evict_oldest ();
+		}
+	}
+}
+
+void nano::vote_cache::evict_oldest ()
+{
+	debug_assert (!mutex.try_lock ());
+
+	while (!insertion_order.empty ())
+	{
+		auto [hash, sequence] = insertion_order.front ();
+		insertion_order.pop_front ();
+
+		// Skip items of entries that were erased (and possibly inserted again) since
+		if (auto existing = cache.find (hash); existing != cache.end () && existing->second.sequence == sequence)
+		{
+			cache.erase (existing);
+			return;
 		}
 	}
 }
 
+void nano::vote_cache::push_tally (entry const & ent)
+{
+	debug_assert (!mutex.try_lock ());
+
+	auto & cached = cache.at (ent.hash ());
+	cached.tally_version = next_sequence++;
+	tally_heap.push_back ({ ent.tally (), ent.hash (), cached.tally_version });
+	std::push_heap (tally_heap.begin (), tally_heap.end ());
+
+	// Bound the memory used by outdated items during vote floods
+	if (tally_heap.size () > 4 * cache.size () + 1024)
+	{
+		compact ();
+	}
+}
+
 bool nano::vote_cache::empty () const
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
@@ -192,10 +236,9 @@ std::vector<std::shared_ptr<nano::vote>> nano::vote_cache::find (const nano::blo
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
 
-	auto & cache_by_hash = cache.get<tag_hash> ();
-	if (auto existing = cache_by_hash.find (hash); existing != cache_by_hash.end ())
+	if (auto existing = cache.find (hash); existing != cache.end ())
 	{
-		return existing->votes ();
+		return existing->second.value.votes ();
 	}
 	return {};
 }
@@ -204,20 +247,16 @@ bool nano::vote_cache::erase (const nano::block_hash & hash)
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
 
-	bool result = false;
-	auto & cache_by_hash = cache.get<tag_hash> ();
-	if (auto existing = cache_by_hash.find (hash); existing != cache_by_hash.end ())
-	{
-		cache_by_hash.erase (existing);
-		result = true;
-	}
-	return result;
+	// Items in `insertion_order` and `tally_heap` are left behind and skipped lazily
+	return cache.erase (hash) > 0;
 }
 
 void nano::vote_cache::clear ()
 {
 	nano::lock_guard<nano::mutex> lock{ mutex };
 	cache.clear ();
+	insertion_order.clear ();
+	tally_heap.clear ();
 }
 
 std::deque<nano::vote_cache::top_entry> nano::vote_cache::top (const nano::uint128_t & min_tally)
@@ -233,14 +272,25 @@ std::deque<nano::vote_cache::top_entry> nano::vote_cache::top (const nano::uint1
 			cleanup ();
 		}
 
-		for (auto & entry : cache.get<tag_tally> ())
+		// Pop items above the threshold, keeping only the ones that still describe the current tally of an entry
+		std::vector<tally_item> current;
+		while (!tally_heap.empty () && tally_heap.front ().tally >= min_tally)
 		{
-			auto tally = entry.tally ();
-			if (tally < min_tally)
+			std::pop_heap (tally_heap.begin (), tally_heap.end ());
+			auto item = tally_heap.back ();
+			tally_heap.pop_back ();
+
+			if (auto existing = cache.find (item.hash); existing != cache.end () && existing->second.tally_version == item.version)
 			{
-				break;
+				auto const & ent = existing->second.value;
+				results.push_back ({ ent.hash (), ent.tally (), ent.final_tally () });
+				current.push_back (item);
 			}
-			results.push_back ({ entry.hash (), tally, entry.final_tally () });
+		}
+		for (auto const & item : current)
+		{
+			tally_heap.push_back (item);
+			std::push_heap (tally_heap.begin (), tally_heap.end ());
 		}
 	}
 
@@ -267,9 +317,27 @@ void nano::vote_cache::cleanup ()
 
 	auto const cutoff = std::chrono::steady_clock::now () - config.age_cutoff;
 
-	erase_if (cache, [cutoff] (auto const & entry) {
-		return entry.last_vote () < cutoff;
+	boost::unordered::erase_if (cache, [cutoff] (auto const & item) {
+		return item.second.value.last_vote () < cutoff;
+	});
+
+	compact ();
+}
+
+void nano::vote_cache::compact ()
+{
+	debug_assert (!mutex.try_lock ());
+
+	// Drop items left behind by erased entries and outdated tallies
+	std::erase_if (insertion_order, [this] (auto const & item) {
+		auto existing = cache.find (item.first);
+		return existing == cache.end () || existing->second.sequence != item.second;
+	});
+	std::erase_if (tally_heap, [this] (auto const & item) {
+		auto existing = cache.find (item.hash);
+		return existing == cache.end () || existing->second.tally_version != item.version;
 	});
+	std::make_heap (tally_heap.begin (), tally_heap.end ());
 }
 
 nano::container_info nano::vote_cache::container_info () const
@@ -278,6 +346,8 @@ nano::container_info nano::vote_cache::container_info () const
 
 	nano::container_info info;
 	info.put ("cache", cache);
+	info.put ("insertion_order", insertion_order);
+	info.put ("tally_heap", tally_heap);
 	return info;
 }
 
@@ -6,21 +6,16 @@
 #include <nano/lib/utility.hpp>
 #include <nano/secure/common.hpp>
 
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/mem_fun.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
 
+#include <deque>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
-namespace mi = boost::multi_index;
-
 namespace nano
 {
 class node;
@@ -92,21 +87,8 @@ private:
 	bool vote_impl (std::shared_ptr<nano::vote> const & vote, nano::uint128_t const & rep_weight, std::size_t max_voters);
 	std::pair<nano::uint128_t, nano::uint128_t> calculate_tally () const; // <tally, final_tally>
 
-	// clang-format off
-	class tag_representative {};
-	class tag_weight {};
-	// clang-format on
-
-	// clang-format off
-	using ordered_voters = boost::multi_index_container<voter_entry,
-	mi::indexed_by<
-		mi::hashed_unique<mi::tag<tag_representative>,
-			mi::member<voter_entry, nano::account, &voter_entry::representative>>,
-		mi::ordered_non_unique<mi::tag<tag_weight>,
-			mi::member<voter_entry, nano::uint128_t, &voter_entry::weight>>
-	>>;
-	// clang-format on
-	ordered_voters voters;
+	// Small enough (bounded by `max_voters`) that linear scans over contiguous storage beat node based indices
+	std::vector<voter_entry> voters;
 
 	nano::block_hash const hash_m;
 	std::chrono::steady_clock::time_point last_vote_m{};
@@ -173,24 +155,36 @@ private: // Dependencies
 private:
 	void insert_impl (std::shared_ptr<nano::vote> const &, nano::block_hash const & hash, nano::uint128_t const & rep_weight);
 	void cleanup ();
+	void compact ();
+	void evict_oldest ();
+	void push_tally (entry const &);
+
+	struct cache_entry
+	{
+		entry value;
+		uint64_t sequence; // Insertion order, used to evict the oldest entries
+		uint64_t tally_version; // Matches the latest `tally_heap` item for this entry
+	};
+
+	struct tally_item
+	{
+		nano::uint128_t tally;
+		nano::block_hash hash;
+		uint64_t version;
+
+		bool operator< (tally_item const & other) const
+		{
+			return tally < other.tally;
+		}
+	};
 
-	// clang-format off
-	class tag_sequenced {};
-	class tag_hash {};
-	class tag_tally {};
-	// clang-format on
-
-	// clang-format off
-	using ordered_cache = boost::multi_index_container<entry,
-	mi::indexed_by<
-		mi::hashed_unique<mi::tag<tag_hash>,
-			mi::const_mem_fun<entry, nano::block_hash, &entry::hash>>,
-		mi::sequenced<mi::tag<tag_sequenced>>,
-		mi::ordered_non_unique<mi::tag<tag_tally>,
-			mi::const_mem_fun<entry, nano::uint128_t, &entry::tally>, std::greater<>> // DESC
-	>>;
-	// clang-format on
-	ordered_cache cache;
+	/** Open addressing table, entries are stored inline so lookups do not chase a node per block */
+	boost::unordered_flat_map<nano::block_hash, cache_entry, std::hash<nano::block_hash>> cache;
+	/** Insertion order, items of erased or replaced entries are skipped when evicting */
+	std::deque<std::pair<nano::block_hash, uint64_t>> insertion_order;
+	/** Max-heap by tally, updated lazily: a new item is pushed whenever a tally changes and outdated items are dropped by `top ()` */
+	std::vector<tally_item> tally_heap;
+	uint64_t next_sequence{ 0 };
 
 	mutable nano::mutex mutex;
 	nano::interval cleanup_interval;
@@ -6,6 +6,7 @@
 #include <nano/node/online_reps.hpp>
 #include <nano/node/rep_tiers.hpp>
 #include <nano/node/repcrawler.hpp>
+#include <nano/node/signatures.hpp>
 #include <nano/node/vote_processor.hpp>
 #include <nano/node/vote_router.hpp>
 #include <nano/secure/common.hpp>
@@ -19,7 +20,7 @@ using namespace std::chrono_literals;
  * vote_processor
  */
 
-nano::vote_processor::vote_processor (vote_processor_config const & config_a, nano::vote_router & vote_router, nano::node_observers & observers_a, nano::stats & stats_a, nano::node_flags & flags_a, nano::logger & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a, nano::rep_tiers & rep_tiers_a) :
+nano::vote_processor::vote_processor (vote_processor_config const & config_a, nano::vote_router & vote_router, nano::node_observers & observers_a, nano::stats & stats_a, nano::node_flags & flags_a, nano::logger & logger_a, nano::online_reps & online_reps_a, nano::rep_crawler & rep_crawler_a, nano::ledger & ledger_a, nano::network_params & network_params_a, nano::rep_tiers & rep_tiers_a, nano::signature_checker & checker_a) :
 	config{ config_a },
 	vote_router{ vote_router },
 	observers{ observers_a },
@@ -29,7 +30,8 @@ nano::vote_processor::vote_processor (vote_processor_config const & config_a, na
 	rep_crawler{ rep_crawler_a },
 	ledger{ ledger_a },
 	network_params{ network_params_a },
-	rep_tiers{ rep_tiers_a }
+	rep_tiers{ rep_tiers_a },
+	checker{ checker_a }
 {
 	queue.max_size_query = [this] (auto const & origin) {
 		switch (origin.source)
@@ -106,17 +108,20 @@ bool nano::vote_processor::vote (std::shared_ptr<nano::vote> const & vote, std::
 
 	auto const tier = rep_tiers.tier (vote->account);
 
-	bool added = false;
-	{
-		nano::lock_guard<nano::mutex> guard{ mutex };
-		added = queue.push ({ vote, source }, { tier, channel });
-	}
+	bool const added = queue.push ({ vote, source }, { tier, channel });
 	if (added)
 	{
 		stats.inc (nano::stat::type::vote_processor, nano::stat::detail::process);
 		stats.inc (nano::stat::type::vote_processor_tier, to_stat_detail (tier));
 
-		condition.notify_one ();
+		// Processing threads register as waiting before checking the queue, so either they see this vote or this sees them waiting
+		if (waiting > 0)
+		{
+			{
+				nano::lock_guard<nano::mutex> guard{ mutex };
+			}
+			condition.notify_one ();
+		}
 	}
 	else
 	{
@@ -141,7 +146,9 @@ void nano::vote_processor::run ()
 		}
 		else
 		{
+			++waiting;
 			condition.wait (lock, [&] { return stopped || !queue.empty (); });
+			--waiting;
 		}
 	}
 }
@@ -150,19 +157,29 @@ void nano::vote_processor::run_batch (nano::unique_lock<nano::mutex> & lock)
 {
 	debug_assert (lock.owns_lock ());
 	debug_assert (!mutex.try_lock ());
-	debug_assert (!queue.empty ());
+
+	lock.unlock ();
 
 	nano::timer<std::chrono::milliseconds> timer;
 	timer.start ();
 
+	// Other processing threads may have taken the queued votes in the meantime, so the batch can be empty
 	auto batch = queue.next_batch (config.batch_size);
 
-	lock.unlock ();
+	// Verify the whole batch at once, signature checking dominates the cost of processing a vote
+	nano::signature_check_set check_set;
+	for (auto const & [item, origin] : batch)
+	{
+		auto const & vote = item.first;
+		check_set.add (vote->hash (), vote->account, vote->signature);
+	}
+	checker.verify (check_set);
 
+	std::size_t index = 0;
 	for (auto const & [item, origin] : batch)
 	{
 		auto const & [vote, source] = item;
-		vote_blocking (vote, origin.channel, source);
+		process (vote, origin.channel, source, check_set.valid (index++));
 	}
 
 	total_processed += batch.size ();
@@ -177,9 +194,14 @@ void nano::vote_processor::run_batch (nano::unique_lock<nano::mutex> & lock)
 }
 
 nano::vote_code nano::vote_processor::vote_blocking (std::shared_ptr<nano::vote> const & vote, std::shared_ptr<nano::transport::channel> const & channel, nano::vote_source source)
+{
+	return process (vote, channel, source, !vote->validate ()); // false => valid vote
+}
+
+nano::vote_code nano::vote_processor::process (std::shared_ptr<nano::vote> const & vote, std::shared_ptr<nano::transport::channel> const & channel, nano::vote_source source, bool valid_signature)
 {
 	auto result = nano::vote_code::invalid;
-	if (!vote->validate ()) // false => valid vote
+	if (valid_signature)
 	{
 		auto vote_results = vote_router.vote (vote, source);
 
@@ -208,20 +230,16 @@ nano::vote_code nano::vote_processor::vote_blocking (std::shared_ptr<nano::vote>
 
 std::size_t nano::vote_processor::size () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
 	return queue.size ();
 }
 
 bool nano::vote_processor::empty () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
 	return queue.empty ();
 }
 
 nano::container_info nano::vote_processor::container_info () const
 {
-	nano::lock_guard<nano::mutex> guard{ mutex };
-
 	nano::container_info info;
 	info.put ("votes", queue.size ());
 	info.add ("queue", queue.container_info ());
@@ -3,12 +3,13 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/threading.hpp>
 #include <nano/lib/utility.hpp>
-#include <nano/node/fair_queue.hpp>
+#include <nano/node/concurrent_fair_queue.hpp>
 #include <nano/node/fwd.hpp>
 #include <nano/node/rep_tiers.hpp>
 #include <nano/node/vote_router.hpp>
 #include <nano/secure/common.hpp>
 
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <thread>
@@ -36,7 +37,7 @@ public:
 class vote_processor final
 {
 public:
-	vote_processor (vote_processor_config const &, nano::vote_router &, nano::node_observers &, nano::stats &, nano::node_flags &, nano::logger &, nano::online_reps &, nano::rep_crawler &, nano::ledger &, nano::network_params &, nano::rep_tiers &);
+	vote_processor (vote_processor_config const &, nano::vote_router &, nano::node_observers &, nano::stats &, nano::node_flags &, nano::logger &, nano::online_reps &, nano::rep_crawler &, nano::ledger &, nano::network_params &, nano::rep_tiers &, nano::signature_checker &);
 	~vote_processor ();
 
 	void start ();
@@ -67,17 +68,22 @@ private: // Dependencies
 	nano::ledger & ledger;
 	nano::network_params & network_params;
 	nano::rep_tiers & rep_tiers;
+	nano::signature_checker & checker;
 
 private:
 	void run ();
 	void run_batch (nano::unique_lock<nano::mutex> &);
+	nano::vote_code process (std::shared_ptr<nano::vote> const &, std::shared_ptr<nano::transport::channel> const &, nano::vote_source, bool valid_signature);
 
 private:
 	using entry_t = std::pair<std::shared_ptr<nano::vote>, nano::vote_source>;
-	nano::fair_queue<entry_t, nano::rep_tier> queue;
+	// Network threads push without taking the mutex below
+	nano::concurrent_fair_queue<entry_t, nano::rep_tier> queue;
 
 private:
 	bool stopped{ false };
+	// Processing threads waiting on the condition, producers only need to lock the mutex to wake them when non zero
+	std::atomic<size_t> waiting{ 0 };
 	nano::condition_variable condition;
 	mutable nano::mutex mutex{ mutex_identifier (mutexes::vote_processor) };
 	std::vector<std::thread> threads;
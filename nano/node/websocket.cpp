@@ -16,7 +16,9 @@
 #include <boost/property_tree/json_parser.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <optional>
 
 nano::websocket::confirmation_options::confirmation_options (nano::wallets & wallets_a, nano::logger & logger_a) :
 	wallets (wallets_a),
@@ -308,7 +310,7 @@ void nano::websocket::session::close ()
 	});
 }
 
-void nano::websocket::session::write (nano::websocket::message message_a)
+void nano::websocket::session::write (nano::websocket::message const & message_a)
 {
 	nano::unique_lock<nano::mutex> lk (subscriptions_mutex);
 	auto subscription (subscriptions.find (message_a.topic));
@@ -317,9 +319,9 @@ void nano::websocket::session::write (nano::websocket::message message_a)
 		lk.unlock ();
 		auto this_l (shared_from_this ());
 		boost::asio::post (ws.get_strand (),
-		[message_a, this_l] () {
+		[buffer = message_a.buffer (), this_l] () {
 			bool write_in_progress = !this_l->send_queue.empty ();
-			this_l->send_queue.emplace_back (message_a);
+			this_l->send_queue.emplace_back (buffer);
 			if (!write_in_progress)
 			{
 				this_l->write_queued_messages ();
@@ -330,10 +332,9 @@ void nano::websocket::session::write (nano::websocket::message message_a)
 
 void nano::websocket::session::write_queued_messages ()
 {
-	auto msg (send_queue.front ().to_string ());
 	auto this_l (shared_from_this ());
 
-	ws.async_write (nano::shared_const_buffer (msg),
+	ws.async_write (nano::shared_const_buffer (send_queue.front ()),
 	[this_l] (boost::system::error_code ec, std::size_t bytes_transferred) {
 		this_l->send_queue.pop_front ();
 		if (!ec)
@@ -649,9 +650,13 @@ void nano::websocket::listener::broadcast_confirmation (std::shared_ptr<nano::bl
 {
 	nano::websocket::message_builder builder;
 
+	// Messages only differ by the non-filtering options, each variant is built and serialized once and shared by all sessions asking for it
+	auto variant_of = [] (nano::websocket::confirmation_options const & options_a) {
+		return static_cast<std::size_t> (options_a.get_include_block ()) | static_cast<std::size_t> (options_a.get_include_election_info ()) << 1 | static_cast<std::size_t> (options_a.get_include_election_info_with_votes ()) << 2 | static_cast<std::size_t> (options_a.get_include_sideband_info ()) << 3;
+	};
+	std::array<std::optional<nano::websocket::message>, 16> messages;
+
 	nano::lock_guard<nano::mutex> lk (sessions_mutex);
-	boost::optional<nano::websocket::message> msg_with_block;
-	boost::optional<nano::websocket::message> msg_without_block;
 	for (auto & weak_session : sessions)
 	{
 		auto session_ptr (weak_session.lock ());
@@ -666,18 +671,13 @@ void nano::websocket::listener::broadcast_confirmation (std::shared_ptr<nano::bl
 				{
 					conf_options = &default_options;
 				}
-				auto include_block (conf_options == nullptr ? true : conf_options->get_include_block ());
 
-				if (include_block && !msg_with_block)
-				{
-					msg_with_block = builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, election_votes_a, *conf_options);
-				}
-				else if (!include_block && !msg_without_block)
+				auto & message = messages[variant_of (*conf_options)];
+				if (!message)
 				{
-					msg_without_block = builder.block_confirmed (block_a, account_a, amount_a, subtype, include_block, election_status_a, election_votes_a, *conf_options);
+					message = builder.block_confirmed (block_a, account_a, amount_a, subtype, conf_options->get_include_block (), election_status_a, election_votes_a, *conf_options);
 				}
-
-				session_ptr->write (include_block ? msg_with_block.get () : msg_without_block.get ());
+				session_ptr->write (*message);
 			}
 		}
 	}
@@ -685,6 +685,9 @@ void nano::websocket::listener::broadcast_confirmation (std::shared_ptr<nano::bl
 
 void nano::websocket::listener::broadcast (nano::websocket::message message_a)
 {
+	// Serialize once up front rather than per session
+	message_a.buffer ();
+
 	nano::lock_guard<nano::mutex> lk (sessions_mutex);
 	for (auto & weak_session : sessions)
 	{
@@ -978,6 +981,16 @@ std::string nano::websocket::message::to_string () const
 	return ostream.str ();
 }
 
+std::shared_ptr<std::vector<uint8_t>> const & nano::websocket::message::buffer () const
+{
+	if (!buffer_m)
+	{
+		auto text = to_string ();
+		buffer_m = std::make_shared<std::vector<uint8_t>> (text.begin (), text.end ());
+	}
+	return buffer_m;
+}
+
 /*
  * websocket_server
  */
@@ -80,8 +80,16 @@ namespace websocket
 		}
 
 		std::string to_string () const;
+		/**
+		 * Serialized contents, shared as an immutable buffer by every session the message is written to
+		 * Serialized on first use, `contents` must not change afterwards
+		 */
+		std::shared_ptr<std::vector<uint8_t>> const & buffer () const;
 		nano::websocket::topic topic;
 		boost::property_tree::ptree contents;
+
+	private:
+		mutable std::shared_ptr<std::vector<uint8_t>> buffer_m;
 	};
 
 	/** Message builder. This is expanded with new builder functions are necessary. */
@@ -259,7 +267,7 @@ namespace websocket
 		void read ();
 
 		/** Enqueue \p message_a for writing to the websockets */
-		void write (nano::websocket::message message_a);
+		void write (nano::websocket::message const & message_a);
 
 	private:
 		/** The owning listener */
@@ -270,8 +278,8 @@ namespace websocket
 
 		/** Buffer for received messages */
 		boost::beast::multi_buffer read_buffer;
-		/** Outgoing messages. The send queue is protected by accessing it only through the strand */
-		std::deque<message> send_queue;
+		/** Outgoing messages, already serialized. The send queue is protected by accessing it only through the strand */
+		std::deque<std::shared_ptr<std::vector<uint8_t>>> send_queue;
 
 		/** Cache remote & local endpoints to make them available after the socket is closed */
 		socket_type::endpoint_type remote;
@@ -6145,6 +6145,36 @@ TEST (rpc, deprecated_account_format)
 	ASSERT_TRUE (deprecated_account_format2.is_initialized ());
 }
 
+// Responses written directly as JSON keep the fields put on the property tree
+TEST (rpc, deprecated_account_format_direct_json)
+{
+	nano::test::system system;
+	auto node = add_ipc_enabled_node (system);
+	auto const rpc_ctx = add_rpc (system, node);
+	std::string account_text (nano::dev::genesis_key.pub.to_account ());
+	account_text[4] = '-';
+	for (auto const action : { "ledger", "delegators", "unopened" })
+	{
+		boost::property_tree::ptree request;
+		request.put ("action", action);
+		request.put ("account", account_text);
+		auto response (wait_response (system, rpc_ctx, request));
+		ASSERT_EQ ("1", response.get<std::string> ("deprecated_account_format")) << action;
+		ASSERT_TRUE (response.get_child_optional (std::string{ action } == "delegators" ? "delegators" : "accounts").is_initialized ()) << action;
+	}
+	boost::property_tree::ptree request;
+	boost::property_tree::ptree child;
+	boost::property_tree::ptree accounts;
+	child.put ("", account_text);
+	accounts.push_back (std::make_pair ("", child));
+	request.add_child ("accounts", accounts);
+	request.put ("action", "accounts_pending");
+	auto response (wait_response (system, rpc_ctx, request));
+	ASSERT_EQ ("1", response.get<std::string> ("deprecated"));
+	ASSERT_EQ ("1", response.get<std::string> ("deprecated_account_format"));
+	ASSERT_TRUE (response.get_child_optional ("blocks").is_initialized ());
+}
+
 TEST (rpc, epoch_upgrade)
 {
 	nano::test::system system;
@@ -212,6 +212,18 @@ enum class block_status
 std::string_view to_string (block_status);
 nano::stat::detail to_stat_detail (block_status);
 
+/**
+ * Outcome of verifying a block signature ahead of ledger processing
+ * Blocks whose signer cannot be determined without ledger access are left as `unknown`
+ */
+enum class signature_verification : uint8_t
+{
+	unknown = 0,
+	invalid = 1, // Not signed by the account, nor by the epoch signer when the link is an epoch link
+	valid = 2, // Signed by the account
+	valid_epoch = 3, // Signed by the epoch signer
+};
+
 enum class tally_result
 {
 	vote,
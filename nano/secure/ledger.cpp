@@ -1,3 +1,4 @@
+#include <nano/crypto/blake2/blake2.h>
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/logging.hpp>
 #include <nano/lib/numbers.hpp>
@@ -20,6 +21,7 @@
 #include <nano/store/pending.hpp>
 #include <nano/store/pruned.hpp>
 #include <nano/store/rep_weight.hpp>
+#include <nano/store/value_view.hpp>
 #include <nano/store/version.hpp>
 
 #include <stack>
@@ -184,7 +186,7 @@ public:
 class ledger_processor : public nano::mutable_block_visitor
 {
 public:
-	ledger_processor (nano::ledger &, nano::secure::write_transaction const &);
+	ledger_processor (nano::ledger &, nano::secure::write_transaction const &, nano::signature_verification);
 	virtual ~ledger_processor () = default;
 	void send_block (nano::send_block &) override;
 	void receive_block (nano::receive_block &) override;
@@ -195,12 +197,28 @@ public:
 	void epoch_block_impl (nano::state_block &);
 	nano::ledger & ledger;
 	nano::secure::write_transaction const & transaction;
+	nano::signature_verification const verification;
 	nano::block_status result;
 
 private:
 	bool validate_epoch_block (nano::state_block const & block_a);
+	bool invalid_signature (nano::account const & signer, nano::block_hash const & hash, nano::signature const & signature, nano::signature_verification expected) const;
 };
 
+// Returns true if the signature is invalid. Results verified ahead of time are used when they apply to this signer.
+bool ledger_processor::invalid_signature (nano::account const & signer, nano::block_hash const & hash, nano::signature const & signature, nano::signature_verification expected) const
+{
+	if (verification == expected)
+	{
+		return false;
+	}
+	if (verification == nano::signature_verification::invalid)
+	{
+		return true;
+	}
+	return validate_message (signer, hash, signature);
+}
+
 // Returns true if this block which has an epoch link is correctly formed.
 bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 {
@@ -216,10 +234,10 @@ bool ledger_processor::validate_epoch_block (nano::state_block const & block_a)
 		else
 		{
 			// Check for possible regular state blocks with epoch link (send subtype)
-			if (validate_message (block_a.hashables.account, block_a.hash (), block_a.signature))
+			if (invalid_signature (block_a.hashables.account, block_a.hash (), block_a.signature, nano::signature_verification::valid))
 			{
 				// Is epoch block signed correctly
-				if (validate_message (ledger.epoch_signer (block_a.link_field ().value ()), block_a.hash (), block_a.signature))
+				if (invalid_signature (ledger.epoch_signer (block_a.link_field ().value ()), block_a.hash (), block_a.signature, nano::signature_verification::valid_epoch))
 				{
 					result = nano::block_status::bad_signature;
 				}
@@ -259,7 +277,7 @@ void ledger_processor::state_block_impl (nano::state_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block before? (Unambiguous)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
+		result = invalid_signature (block_a.hashables.account, hash, block_a.signature, nano::signature_verification::valid) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -375,7 +393,7 @@ void ledger_processor::epoch_block_impl (nano::state_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block before? (Unambiguous)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
+		result = invalid_signature (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature, nano::signature_verification::valid_epoch) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Unambiguous)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (ledger.epoch_signer (block_a.hashables.link), hash, block_a.signature));
@@ -457,7 +475,7 @@ void ledger_processor::change_block (nano::change_block & block_a)
 				if (result == nano::block_status::progress)
 				{
 					debug_assert (info->head == block_a.hashables.previous);
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
+					result = invalid_signature (account, hash, block_a.signature, nano::signature_verification::valid) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
@@ -500,7 +518,7 @@ void ledger_processor::send_block (nano::send_block & block_a)
 				result = info->head != block_a.hashables.previous ? nano::block_status::fork : nano::block_status::progress;
 				if (result == nano::block_status::progress)
 				{
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
+					result = invalid_signature (account, hash, block_a.signature, nano::signature_verification::valid) ? nano::block_status::bad_signature : nano::block_status::progress; // Is this block signed correctly (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						nano::block_details block_details (nano::epoch::epoch_0, false /* unused */, false /* unused */, false /* unused */);
@@ -549,7 +567,7 @@ void ledger_processor::receive_block (nano::receive_block & block_a)
 				result = info->head != block_a.hashables.previous ? nano::block_status::fork : nano::block_status::progress; // If we have the block but it's not the latest we have a signed fork (Malicious)
 				if (result == nano::block_status::progress)
 				{
-					result = validate_message (account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
+					result = invalid_signature (account, hash, block_a.signature, nano::signature_verification::valid) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
 					if (result == nano::block_status::progress)
 					{
 						debug_assert (!validate_message (account, hash, block_a.signature));
@@ -598,7 +616,7 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	result = existing ? nano::block_status::old : nano::block_status::progress; // Have we seen this block already? (Harmless)
 	if (result == nano::block_status::progress)
 	{
-		result = validate_message (block_a.hashables.account, hash, block_a.signature) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
+		result = invalid_signature (block_a.hashables.account, hash, block_a.signature, nano::signature_verification::valid) ? nano::block_status::bad_signature : nano::block_status::progress; // Is the signature valid (Malformed)
 		if (result == nano::block_status::progress)
 		{
 			debug_assert (!validate_message (block_a.hashables.account, hash, block_a.signature));
@@ -641,9 +659,10 @@ void ledger_processor::open_block (nano::open_block & block_a)
 	}
 }
 
-ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::secure::write_transaction const & transaction_a) :
+ledger_processor::ledger_processor (nano::ledger & ledger_a, nano::secure::write_transaction const & transaction_a, nano::signature_verification verification_a) :
 	ledger (ledger_a),
-	transaction (transaction_a)
+	transaction (transaction_a),
+	verification (verification_a)
 {
 }
 
@@ -746,6 +765,16 @@ auto nano::ledger::tx_begin_read () const -> secure::read_transaction
 
 void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache_flags_a)
 {
+	if (!load_cache ())
+	{
+		cache_complete = true;
+		auto transaction (store.tx_begin_read ());
+		cache.pruned_count = store.pruned.count (transaction);
+		return;
+	}
+
+	cache_complete = generate_cache_flags_a.reps && generate_cache_flags_a.account_count && generate_cache_flags_a.block_count && generate_cache_flags_a.cemented_count;
+
 	if (generate_cache_flags_a.reps || generate_cache_flags_a.account_count || generate_cache_flags_a.block_count)
 	{
 		store.account.for_each_par (
@@ -754,8 +783,8 @@ void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache
 			uint64_t account_count_l{ 0 };
 			for (; i != n; ++i)
 			{
-				nano::account_info const & info (i->second);
-				block_count_l += info.block_count;
+				// Only the block count is needed, read it in place rather than deserializing every account
+				block_count_l += i.value_view<nano::store::account_info_view> ().block_count ();
 				++account_count_l;
 			}
 			this->cache.block_count += block_count_l;
@@ -790,6 +819,65 @@ void nano::ledger::initialize (nano::generate_cache_flags const & generate_cache
 	cache.pruned_count = store.pruned.count (transaction);
 }
 
+bool nano::ledger::load_cache ()
+{
+	auto transaction (store.tx_begin_read ());
+	auto snapshot = store.version.cache_get (transaction);
+	if (!snapshot)
+	{
+		return true;
+	}
+
+	auto error = snapshot->size () < sizeof (nano::uint256_union);
+	if (!error)
+	{
+		auto const payload_size = snapshot->size () - sizeof (nano::uint256_union);
+		nano::uint256_union checksum;
+		blake2b_state hash;
+		blake2b_init (&hash, sizeof (checksum.bytes));
+		blake2b_update (&hash, snapshot->data (), payload_size);
+		blake2b_final (&hash, checksum.bytes.data (), sizeof (checksum.bytes));
+		error = !std::equal (checksum.bytes.begin (), checksum.bytes.end (), snapshot->begin () + payload_size);
+		if (!error)
+		{
+			nano::bufferstream stream{ snapshot->data (), payload_size };
+			uint8_t version{ 0 };
+			uint64_t sequence{ 0 };
+			error = nano::try_read (stream, version) || nano::try_read (stream, sequence);
+			// Any write after the snapshot was saved, including by older node versions or CLI commands, makes it stale
+			error = error || version != cache_snapshot_version || sequence != store.sequence (transaction);
+			error = error || cache.deserialize (stream);
+		}
+	}
+	stats.inc (nano::stat::type::ledger, error ? nano::stat::detail::cache_snapshot_invalid : nano::stat::detail::cache_snapshot_loaded);
+	return error;
+}
+
+void nano::ledger::save_cache ()
+{
+	if (!cache_complete)
+	{
+		return;
+	}
+	auto transaction = tx_begin_write ();
+	std::vector<uint8_t> snapshot;
+	{
+		nano::vectorstream stream{ snapshot };
+		nano::write (stream, cache_snapshot_version);
+		// Saving the snapshot is the only write of this transaction, committing it advances the store sequence by one for both LMDB and RocksDB
+		nano::write (stream, store.sequence (transaction) + 1);
+		cache.serialize (stream);
+	}
+	nano::uint256_union checksum;
+	blake2b_state hash;
+	blake2b_init (&hash, sizeof (checksum.bytes));
+	blake2b_update (&hash, snapshot.data (), snapshot.size ());
+	blake2b_final (&hash, checksum.bytes.data (), sizeof (checksum.bytes));
+	snapshot.insert (snapshot.end (), checksum.bytes.begin (), checksum.bytes.end ());
+	store.version.cache_put (transaction, snapshot);
+	stats.inc (nano::stat::type::ledger, nano::stat::detail::cache_snapshot_saved);
+}
+
 nano::uint128_t nano::ledger::account_receivable (secure::transaction const & transaction_a, nano::account const & account_a, bool only_confirmed_a)
 {
 	nano::uint128_t result (0);
@@ -878,20 +966,91 @@ std::deque<std::shared_ptr<nano::block>> nano::ledger::confirm (secure::write_tr
 	return result;
 }
 
+std::deque<std::shared_ptr<nano::block>> nano::ledger::confirm_plan (secure::transaction const & transaction, nano::block_hash const & target_hash, std::unordered_set<nano::block_hash> & planned, size_t max_blocks) const
+{
+	std::deque<std::shared_ptr<nano::block>> result;
+
+	auto is_confirmed = [&] (nano::block_hash const & hash) {
+		return planned.contains (hash) || confirmed.block_exists_or_pruned (transaction, hash);
+	};
+
+	std::deque<nano::block_hash> stack;
+	stack.push_back (target_hash);
+	while (!stack.empty ())
+	{
+		auto hash = stack.back ();
+		auto block = any.block_get (transaction, hash);
+		if (!block)
+		{
+			// Rolled back since it was queued, the remaining plan is still valid
+			break;
+		}
+
+		auto dependents = dependent_blocks (transaction, *block);
+		for (auto const & dependent : dependents)
+		{
+			if (!dependent.is_zero () && !is_confirmed (dependent))
+			{
+				stack.push_back (dependent);
+
+				// Same memory limit as `confirm`, this forgets the bottom of the dependency tree
+				if (stack.size () > max_blocks)
+				{
+					stack.pop_front ();
+				}
+			}
+		}
+
+		if (stack.back () == hash)
+		{
+			stack.pop_back ();
+			if (!is_confirmed (hash))
+			{
+				planned.insert (hash);
+				result.push_back (block);
+			}
+		}
+
+		if (result.size () >= max_blocks)
+		{
+			break;
+		}
+	}
+
+	return result;
+}
+
+bool nano::ledger::confirm_planned (secure::write_transaction & transaction, nano::block const & block)
+{
+	// The plan was made with a read transaction, blocks might have been confirmed or rolled back since then
+	if (confirmed.block_exists_or_pruned (transaction, block.hash ()) || !any.block_exists (transaction, block.hash ()) || !dependents_confirmed (transaction, block))
+	{
+		return false;
+	}
+	confirm_one (transaction, block);
+	return true;
+}
+
 void nano::ledger::confirm_one (secure::write_transaction & transaction, nano::block const & block)
 {
 	debug_assert ((!store.confirmation_height.get (transaction, block.account ()) && block.sideband ().height == 1) || store.confirmation_height.get (transaction, block.account ()).value ().height + 1 == block.sideband ().height);
 	confirmation_height_info info{ block.sideband ().height, block.hash () };
 	store.confirmation_height.put (transaction, block.account (), info);
 	++cache.cemented_count;
+	cache.unconfirmed.erase (block.account (), info.height);
 
 	stats.inc (nano::stat::type::confirmation_height, nano::stat::detail::blocks_confirmed);
 }
 
 nano::block_status nano::ledger::process (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> block_a)
+{
+	return process (transaction_a, std::move (block_a), nano::signature_verification::unknown);
+}
+
+nano::block_status nano::ledger::process (secure::write_transaction const & transaction_a, std::shared_ptr<nano::block> block_a, nano::signature_verification verification_a)
 {
 	debug_assert (!constants.work.validate_entry (*block_a) || constants.genesis == nano::dev::genesis);
-	ledger_processor processor (*this, transaction_a);
+	ledger_processor processor (*this, transaction_a, verification_a);
 	block_a->visit (processor);
 	if (processor.result == nano::block_status::progress)
 	{
@@ -1200,6 +1359,8 @@ void nano::ledger::update_account (secure::write_transaction const & transaction
 		debug_assert (cache.account_count > 0);
 		--cache.account_count;
 	}
+	// Conservatively tracked on every change, including rollbacks down to the confirmation height, backlog population drops confirmed entries
+	cache.unconfirmed.put (account_a, new_a.block_count);
 }
 
 std::shared_ptr<nano::block> nano::ledger::forked_block (secure::transaction const & transaction_a, nano::block const & block_a)
@@ -1519,5 +1680,6 @@ nano::container_info nano::ledger::container_info () const
 	nano::container_info info;
 	info.put ("bootstrap_weights", bootstrap_weights);
 	info.add ("rep_weights", cache.rep_weights.container_info ());
+	info.add ("unconfirmed", cache.unconfirmed.container_info ());
 	return info;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <unordered_set>
 
 namespace nano::store
 {
@@ -22,6 +23,7 @@ namespace nano
 class block;
 enum class block_status;
 enum class epoch : uint8_t;
+enum class signature_verification : uint8_t;
 class ledger_constants;
 class ledger_set_any;
 class ledger_set_confirmed;
@@ -61,7 +63,16 @@ public:
 	std::pair<nano::block_hash, nano::block_hash> hash_root_random (secure::transaction const &) const;
 	std::optional<nano::pending_info> pending_info (secure::transaction const &, nano::pending_key const & key) const;
 	std::deque<std::shared_ptr<nano::block>> confirm (secure::write_transaction &, nano::block_hash const & hash, size_t max_blocks = 1024 * 128);
+	/**
+	 * Read-only counterpart of `confirm`, returns unconfirmed blocks `hash` depends on (including itself) in the order they need to be confirmed.
+	 * Blocks in `planned` are treated as confirmed, returned blocks are added to it so that consecutive plans do not overlap.
+	 */
+	std::deque<std::shared_ptr<nano::block>> confirm_plan (secure::transaction const &, nano::block_hash const & hash, std::unordered_set<nano::block_hash> & planned, size_t max_blocks = 1024 * 128) const;
+	/** Confirms a single block from a plan, returns false if it is already confirmed or no longer has all of its dependencies confirmed */
+	bool confirm_planned (secure::write_transaction &, nano::block const & block);
 	nano::block_status process (secure::write_transaction const &, std::shared_ptr<nano::block> block);
+	/** `verification` carries the result of checking the block signature ahead of time, so the ledger does not need to repeat it */
+	nano::block_status process (secure::write_transaction const &, std::shared_ptr<nano::block> block, nano::signature_verification verification);
 	bool rollback (secure::write_transaction const &, nano::block_hash const &, std::vector<std::shared_ptr<nano::block>> &);
 	bool rollback (secure::write_transaction const &, nano::block_hash const &);
 	void update_account (secure::write_transaction const &, nano::account const &, nano::account_info const &, nano::account_info const &);
@@ -84,6 +95,12 @@ public:
 
 	nano::container_info container_info () const;
 
+	/**
+	 * Persists the ledger cache so the next startup can skip rescanning the ledger
+	 * Must only be called once nothing else writes to the store, the snapshot is discarded on load if any write happened after it was saved
+	 */
+	void save_cache ();
+
 public:
 	static nano::uint128_t const unit;
 
@@ -100,8 +117,14 @@ public:
 
 private:
 	void initialize (nano::generate_cache_flags const &);
+	/** Returns true if the snapshot is missing or stale */
+	bool load_cache ();
 	void confirm_one (secure::write_transaction &, nano::block const & block);
 
+	/** Whether every cached count and weight reflects the ledger, only a complete cache is saved */
+	bool cache_complete{ false };
+	static uint8_t constexpr cache_snapshot_version{ 2 };
+
 	std::unique_ptr<ledger_set_any> any_impl;
 	std::unique_ptr<ledger_set_confirmed> confirmed_impl;
 
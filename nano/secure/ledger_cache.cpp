@@ -1,6 +1,68 @@
 #include <nano/secure/ledger_cache.hpp>
 
 nano::ledger_cache::ledger_cache (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_rep_weight_a) :
-	rep_weights{ rep_weight_store_a, min_rep_weight_a }
+	rep_weights{ rep_weight_store_a, min_rep_weight_a },
+	min_rep_weight{ min_rep_weight_a }
 {
 }
+
+void nano::ledger_cache::serialize (nano::stream & stream_a) const
+{
+	nano::write (stream_a, nano::uint128_union{ min_rep_weight });
+	nano::write (stream_a, cemented_count.load ());
+	nano::write (stream_a, block_count.load ());
+	nano::write (stream_a, account_count.load ());
+	auto const rep_amounts = rep_weights.get_rep_amounts ();
+	nano::write (stream_a, static_cast<uint64_t> (rep_amounts.size ()));
+	for (auto const & [representative, weight] : rep_amounts)
+	{
+		nano::write (stream_a, representative);
+		nano::write (stream_a, nano::uint128_union{ weight });
+	}
+	unconfirmed.serialize (stream_a);
+}
+
+bool nano::ledger_cache::deserialize (nano::stream & stream_a)
+{
+	try
+	{
+		nano::uint128_union min_rep_weight_l;
+		uint64_t cemented_count_l;
+		uint64_t block_count_l;
+		uint64_t account_count_l;
+		uint64_t rep_count;
+		nano::read (stream_a, min_rep_weight_l);
+		nano::read (stream_a, cemented_count_l);
+		nano::read (stream_a, block_count_l);
+		nano::read (stream_a, account_count_l);
+		nano::read (stream_a, rep_count);
+		if (min_rep_weight_l.number () != min_rep_weight)
+		{
+			// Representatives below a different minimum weight were left out or kept
+			return true;
+		}
+		std::vector<std::pair<nano::account, nano::uint128_union>> rep_amounts (rep_count);
+		for (auto & [representative, weight] : rep_amounts)
+		{
+			nano::read (stream_a, representative);
+			nano::read (stream_a, weight);
+		}
+		if (unconfirmed.deserialize (stream_a) || !nano::at_end (stream_a))
+		{
+			unconfirmed.clear ();
+			return true;
+		}
+		cemented_count = cemented_count_l;
+		block_count = block_count_l;
+		account_count = account_count_l;
+		for (auto const & [representative, weight] : rep_amounts)
+		{
+			rep_weights.representation_put (representative, weight.number ());
+		}
+	}
+	catch (std::runtime_error const &)
+	{
+		return true;
+	}
+	return false;
+}
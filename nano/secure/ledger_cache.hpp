@@ -1,7 +1,9 @@
 #pragma once
 
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/stream.hpp>
 #include <nano/secure/rep_weights.hpp>
+#include <nano/secure/unconfirmed_accounts.hpp>
 #include <nano/store/rep_weight.hpp>
 
 #include <atomic>
@@ -26,8 +28,15 @@ class ledger_cache
 public:
 	explicit ledger_cache (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_rep_weight_a = 0);
 	nano::rep_weights rep_weights;
+	nano::unconfirmed_accounts unconfirmed;
+
+	/** Counts, cached representative weights and the unconfirmed accounts index, persisted so startup does not have to rescan the ledger */
+	void serialize (nano::stream &) const;
+	/** Returns true on error or when the snapshot was taken with a different minimum representative weight */
+	bool deserialize (nano::stream &);
 
 private:
+	nano::uint128_t const min_rep_weight;
 	std::atomic<uint64_t> cemented_count{ 0 };
 	std::atomic<uint64_t> block_count{ 0 };
 	std::atomic<uint64_t> pruned_count{ 0 };
@@ -1,9 +1,17 @@
 #pragma once
 
+#include <nano/lib/locks.hpp>
+#include <nano/lib/thread_pool.hpp>
 #include <nano/lib/thread_roles.hpp>
 #include <nano/lib/threading.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 template <typename T>
@@ -31,3 +39,54 @@ void parallel_traversal (std::function<void (T const &, T const &, bool const)>
 		thread.join ();
 	}
 }
+
+/**
+ * Splits the keys from `start` up to the maximum value into one range per thread of `pool` and calls `action (begin, end, is_last)` for each range
+ * Results are returned in key order, so concatenating them gives the same sequence a single sequential scan from `start` would produce
+ * The calling thread takes ranges as well and runs any the pool has not started yet, so this never waits on a busy or stopped pool
+ */
+template <typename T, typename Action>
+auto parallel_traversal (nano::thread_pool & pool, T const & start, Action const & action)
+{
+	using result_t = std::invoke_result_t<Action, T const &, T const &, bool const>;
+
+	struct state_t
+	{
+		std::vector<result_t> results;
+		std::atomic<unsigned> next{ 0 };
+		unsigned done{ 0 };
+		nano::mutex mutex;
+		nano::condition_variable condition;
+	};
+
+	unsigned const partitions = std::max (1u, pool.get_num_threads ());
+	T const split = (std::numeric_limits<T>::max () - start) / partitions;
+	auto state = std::make_shared<state_t> ();
+	state->results.resize (partitions);
+
+	// Pool tasks may only start after all ranges were taken and this function returned, they must not touch `action` then
+	auto run = [state, partitions, split, start, action = &action] () {
+		for (auto index = state->next++; index < partitions; index = state->next++)
+		{
+			T const begin = start + split * index;
+			T const end = start + split * (index + 1);
+			bool const is_last = index == partitions - 1;
+			state->results[index] = (*action) (begin, end, is_last);
+
+			nano::lock_guard<nano::mutex> guard{ state->mutex };
+			if (++state->done == partitions)
+			{
+				state->condition.notify_all ();
+			}
+		}
+	};
+	for (unsigned i = 1; i < partitions; ++i)
+	{
+		pool.push_task (run);
+	}
+	run ();
+
+	nano::unique_lock<nano::mutex> lock{ state->mutex };
+	state->condition.wait (lock, [&state, partitions] { return state->done == partitions; });
+	return std::move (state->results);
+}
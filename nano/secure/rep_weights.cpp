@@ -1,12 +1,18 @@
+#include <nano/crypto_lib/random_pool.hpp>
 #include <nano/lib/numbers.hpp>
 #include <nano/secure/rep_weights.hpp>
 #include <nano/store/component.hpp>
 #include <nano/store/rep_weight.hpp>
 
+#include <thread>
+
 nano::rep_weights::rep_weights (nano::store::rep_weight & rep_weight_store_a, nano::uint128_t min_weight_a) :
+	seed{ nano::random_pool::generate<uint64_t> () },
 	rep_weight_store{ rep_weight_store_a },
 	min_weight{ min_weight_a }
 {
+	tables.push_back (std::make_unique<table> (initial_capacity, seed));
+	current = tables.back ().get ();
 }
 
 void nano::rep_weights::representation_add (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & amount_a)
@@ -14,8 +20,10 @@ void nano::rep_weights::representation_add (store::write_transaction const & txn
 	auto previous_weight{ rep_weight_store.get (txn_a, rep_a) };
 	auto new_weight = previous_weight + amount_a;
 	put_store (txn_a, rep_a, previous_weight, new_weight);
-	std::unique_lock guard{ mutex };
+	std::lock_guard guard{ mutex };
+	write_begin ();
 	put_cache (rep_a, new_weight);
+	write_end ();
 }
 
 void nano::rep_weights::representation_add_dual (store::write_transaction const & txn_a, nano::account const & rep_1, nano::uint128_t const & amount_1, nano::account const & rep_2, nano::uint128_t const & amount_2)
@@ -28,9 +36,12 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 		auto new_weight_2 = previous_weight_2 + amount_2;
 		put_store (txn_a, rep_1, previous_weight_1, new_weight_1);
 		put_store (txn_a, rep_2, previous_weight_2, new_weight_2);
-		std::unique_lock guard{ mutex };
+		std::lock_guard guard{ mutex };
+		// Readers observe weight moving between representatives as a single change
+		write_begin ();
 		put_cache (rep_1, new_weight_1);
 		put_cache (rep_2, new_weight_2);
+		write_end ();
 	}
 	else
 	{
@@ -40,55 +51,107 @@ void nano::rep_weights::representation_add_dual (store::write_transaction const
 
 void nano::rep_weights::representation_put (nano::account const & account_a, nano::uint128_t const & representation_a)
 {
-	std::unique_lock guard{ mutex };
+	std::lock_guard guard{ mutex };
+	write_begin ();
 	put_cache (account_a, representation_a);
+	write_end ();
 }
 
 nano::uint128_t nano::rep_weights::representation_get (nano::account const & account_a) const
 {
-	std::shared_lock lk{ mutex };
-	return get (account_a);
+	while (true)
+	{
+		auto const begin = sequence.load (std::memory_order_acquire);
+		if (begin % 2 != 0)
+		{
+			std::this_thread::yield ();
+			continue;
+		}
+		// The table may be modified while probing it, the result is only used if no write started in the meantime
+		// Slot loads are acquire operations so the closing sequence load cannot be reordered before them
+		nano::uint128_t result{ 0 };
+		auto const * slot_l = current.load (std::memory_order_acquire)->find (account_a);
+		if (slot_l != nullptr && slot_l->state.load (std::memory_order_acquire) == slot_state::occupied && slot_l->matches (account_a))
+		{
+			result = slot_l->load_weight ();
+		}
+		if (sequence.load (std::memory_order_relaxed) == begin)
+		{
+			return result;
+		}
+	}
 }
 
 /** Makes a copy */
 std::unordered_map<nano::account, nano::uint128_t> nano::rep_weights::get_rep_amounts () const
 {
-	std::shared_lock guard{ mutex };
-	return rep_amounts;
+	std::lock_guard guard{ mutex };
+	std::unordered_map<nano::account, nano::uint128_t> result;
+	result.reserve (occupied);
+	for_each ([&result] (nano::account const & account, nano::uint128_t const & weight) {
+		result.emplace (account, weight);
+	});
+	return result;
 }
 
 void nano::rep_weights::copy_from (nano::rep_weights & other_a)
 {
-	std::unique_lock guard_this{ mutex };
-	std::shared_lock guard_other{ other_a.mutex };
-	for (auto const & entry : other_a.rep_amounts)
-	{
-		auto prev_amount (get (entry.first));
-		put_cache (entry.first, prev_amount + entry.second);
-	}
+	std::lock_guard guard_this{ mutex };
+	std::lock_guard guard_other{ other_a.mutex };
+	write_begin ();
+	other_a.for_each ([this] (nano::account const & account, nano::uint128_t const & weight) {
+		put_cache (account, get (account) + weight);
+	});
+	write_end ();
+}
+
+void nano::rep_weights::write_begin ()
+{
+	// Slot stores are release operations, a reader observing any of them also observes the odd sequence
+	sequence.store (sequence.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void nano::rep_weights::write_end ()
+{
+	sequence.store (sequence.load (std::memory_order_relaxed) + 1, std::memory_order_release);
 }
 
-void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint128_union const & representation_a)
+void nano::rep_weights::put_cache (nano::account const & account_a, nano::uint128_t const & representation_a)
 {
-	auto it = rep_amounts.find (account_a);
+	auto * slot_l = current.load (std::memory_order_relaxed)->find (account_a);
+	debug_assert (slot_l != nullptr);
+	bool const exists = slot_l->state.load (std::memory_order_relaxed) == slot_state::occupied;
 	if (representation_a < min_weight || representation_a.is_zero ())
 	{
-		if (it != rep_amounts.end ())
+		if (exists)
 		{
-			rep_amounts.erase (it);
+			slot_l->state.store (slot_state::erased, std::memory_order_release);
+			--occupied;
+			++erased;
+			--count;
 		}
 	}
+	else if (exists)
+	{
+		slot_l->store (account_a, representation_a);
+	}
 	else
 	{
-		auto amount = representation_a.number ();
-		if (it != rep_amounts.end ())
+		auto const capacity = current.load (std::memory_order_relaxed)->capacity;
+		if ((occupied + erased + 1) * 4 > capacity * 3)
 		{
-			it->second = amount;
+			// Grow when mostly occupied, otherwise only clear erased slots
+			rehash ((occupied + 1) * 2 > capacity ? capacity * 2 : capacity);
+			slot_l = current.load (std::memory_order_relaxed)->find (account_a);
 		}
-		else
+		if (slot_l->state.load (std::memory_order_relaxed) == slot_state::erased)
 		{
-			rep_amounts.emplace (account_a, amount);
+			--erased;
 		}
+		slot_l->store (account_a, representation_a);
+		slot_l->state.store (slot_state::occupied, std::memory_order_release);
+		++occupied;
+		++count;
 	}
 }
 
@@ -109,10 +172,10 @@ void nano::rep_weights::put_store (store::write_transaction const & txn_a, nano:
 
 nano::uint128_t nano::rep_weights::get (nano::account const & account_a) const
 {
-	auto it = rep_amounts.find (account_a);
-	if (it != rep_amounts.end ())
+	auto const * slot_l = current.load (std::memory_order_relaxed)->find (account_a);
+	if (slot_l != nullptr && slot_l->state.load (std::memory_order_relaxed) == slot_state::occupied)
 	{
-		return it->second;
+		return slot_l->load_weight ();
 	}
 	else
 	{
@@ -120,17 +183,158 @@ nano::uint128_t nano::rep_weights::get (nano::account const & account_a) const
 	}
 }
 
+void nano::rep_weights::rehash (std::size_t capacity_a)
+{
+	std::vector<std::pair<nano::account, nano::uint128_t>> entries;
+	entries.reserve (occupied);
+	for_each ([&entries] (nano::account const & account, nano::uint128_t const & weight) {
+		entries.emplace_back (account, weight);
+	});
+
+	auto * target = current.load (std::memory_order_relaxed);
+	if (capacity_a > target->capacity)
+	{
+		tables.push_back (std::make_unique<table> (capacity_a, seed));
+		target = tables.back ().get ();
+	}
+	else
+	{
+		// Rebuilt in place, concurrent readers retry as a write is in progress
+		for (std::size_t i = 0; i < target->capacity; ++i)
+		{
+			target->slots[i].state.store (slot_state::empty, std::memory_order_release);
+		}
+	}
+	for (auto const & [account, weight] : entries)
+	{
+		auto * slot_l = target->find (account);
+		slot_l->store (account, weight);
+		slot_l->state.store (slot_state::occupied, std::memory_order_release);
+	}
+	erased = 0;
+	current.store (target, std::memory_order_release);
+}
+
+template <typename Func>
+void nano::rep_weights::for_each (Func const & func) const
+{
+	auto const & table_l = *current.load (std::memory_order_relaxed);
+	for (std::size_t i = 0; i < table_l.capacity; ++i)
+	{
+		auto const & slot_l = table_l.slots[i];
+		if (slot_l.state.load (std::memory_order_relaxed) == slot_state::occupied)
+		{
+			func (slot_l.load_account (), slot_l.load_weight ());
+		}
+	}
+}
+
 std::size_t nano::rep_weights::size () const
 {
-	std::shared_lock guard{ mutex };
-	return rep_amounts.size ();
+	return count;
 }
 
 nano::container_info nano::rep_weights::container_info () const
 {
-	std::shared_lock guard{ mutex };
+	std::lock_guard guard{ mutex };
 
 	nano::container_info info;
-	info.put ("rep_amounts", rep_amounts);
+	info.put ("rep_amounts", count, sizeof (slot));
+	info.put ("slots", current.load ()->capacity, sizeof (slot));
 	return info;
 }
+
+/*
+ * slot
+ */
+
+bool nano::rep_weights::slot::matches (nano::account const & account_a) const
+{
+	for (std::size_t i = 0; i < account.size (); ++i)
+	{
+		if (account[i].load (std::memory_order_acquire) != account_a.qwords[i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+nano::account nano::rep_weights::slot::load_account () const
+{
+	nano::account result;
+	for (std::size_t i = 0; i < account.size (); ++i)
+	{
+		result.qwords[i] = account[i].load (std::memory_order_acquire);
+	}
+	return result;
+}
+
+nano::uint128_t nano::rep_weights::slot::load_weight () const
+{
+	nano::uint128_union result;
+	for (std::size_t i = 0; i < weight.size (); ++i)
+	{
+		result.qwords[i] = weight[i].load (std::memory_order_acquire);
+	}
+	return result.number ();
+}
+
+void nano::rep_weights::slot::store (nano::account const & account_a, nano::uint128_t const & weight_a)
+{
+	nano::uint128_union const weight_l{ weight_a };
+	for (std::size_t i = 0; i < account.size (); ++i)
+	{
+		account[i].store (account_a.qwords[i], std::memory_order_release);
+	}
+	for (std::size_t i = 0; i < weight.size (); ++i)
+	{
+		weight[i].store (weight_l.qwords[i], std::memory_order_release);
+	}
+}
+
+/*
+ * table
+ */
+
+nano::rep_weights::table::table (std::size_t capacity_a, uint64_t seed_a) :
+	capacity{ capacity_a },
+	seed{ seed_a },
+	slots{ std::make_unique<slot[]> (capacity_a) }
+{
+	debug_assert ((capacity & (capacity - 1)) == 0);
+}
+
+auto nano::rep_weights::table::find (nano::account const & account_a) const -> slot *
+{
+	uint64_t hash = seed;
+	for (auto word : account_a.qwords)
+	{
+		hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+	}
+	// Multiplication only carries bits upwards, fold high bits into the low ones used for indexing
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	slot * free = nullptr;
+	// Bounded as readers may probe a table which is being rebuilt
+	for (std::size_t probe = 0; probe < capacity; ++probe)
+	{
+		auto & slot_l = slots[(hash + probe) & (capacity - 1)];
+		switch (slot_l.state.load (std::memory_order_acquire))
+		{
+			case slot_state::empty:
+				return free != nullptr ? free : &slot_l;
+			case slot_state::erased:
+				free = free != nullptr ? free : &slot_l;
+				break;
+			case slot_state::occupied:
+				if (slot_l.matches (account_a))
+				{
+					return &slot_l;
+				}
+				break;
+		}
+	}
+	return free;
+}
@@ -3,9 +3,12 @@
 #include <nano/lib/numbers.hpp>
 #include <nano/lib/utility.hpp>
 
+#include <array>
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace nano
 {
@@ -16,6 +19,11 @@ namespace store
 	class write_transaction;
 }
 
+/**
+ * Cache of representative weights above a minimum weight
+ * Reads are lock free: entries live in an open addressing table of atomic words guarded by a sequence lock, readers retry when a write overlapped their lookup
+ * Writers are serialized and publish each ledger operation, including both sides of a dual update, as a single write section
+ */
 class rep_weights
 {
 public:
@@ -32,12 +40,62 @@ public:
 	nano::container_info container_info () const;
 
 private:
-	mutable std::shared_mutex mutex;
-	std::unordered_map<nano::account, nano::uint128_t> rep_amounts;
+	enum class slot_state : uint8_t
+	{
+		empty,
+		occupied,
+		erased,
+	};
+
+	class slot
+	{
+	public:
+		std::atomic<slot_state> state{ slot_state::empty };
+		std::array<std::atomic<uint64_t>, 4> account{};
+		std::array<std::atomic<uint64_t>, 2> weight{};
+
+		bool matches (nano::account const &) const;
+		nano::account load_account () const;
+		nano::uint128_t load_weight () const;
+		void store (nano::account const &, nano::uint128_t const &);
+	};
+
+	class table
+	{
+	public:
+		table (std::size_t capacity, uint64_t seed);
+		std::size_t const capacity; // Power of two
+		uint64_t const seed;
+		std::unique_ptr<slot[]> slots;
+
+		/** Slot holding the account, otherwise the first free slot of its probe sequence */
+		slot * find (nano::account const &) const;
+	};
+
+	std::size_t static constexpr initial_capacity{ 1024 };
+	// Randomized per instance so representative accounts cannot be chosen to collide
+	uint64_t const seed;
+
+	mutable std::mutex mutex; // Serializes writers, readers never lock
+	std::atomic<uint64_t> sequence{ 0 }; // Odd while a write is in progress
+	std::atomic<table *> current{ nullptr };
+	// Tables replaced by a larger one are kept alive as readers may still be probing them, capacity doubles each time so they never outweigh the current table
+	std::vector<std::unique_ptr<table>> tables;
+	std::size_t occupied{ 0 };
+	std::size_t erased{ 0 };
+	std::atomic<std::size_t> count{ 0 };
+
 	nano::store::rep_weight & rep_weight_store;
-	nano::uint128_t min_weight;
-	void put_cache (nano::account const & account_a, nano::uint128_union const & representation_a);
+	nano::uint128_t const min_weight;
+
+	void write_begin ();
+	void write_end ();
+	void put_cache (nano::account const & account_a, nano::uint128_t const & representation_a);
 	void put_store (store::write_transaction const & txn_a, nano::account const & rep_a, nano::uint128_t const & previous_weight_a, nano::uint128_t const & new_weight_a);
+	/** Must be called by a writer, the table cannot change underneath */
 	nano::uint128_t get (nano::account const & account_a) const;
+	void rehash (std::size_t capacity);
+	template <typename Func>
+	void for_each (Func const &) const;
 };
 }
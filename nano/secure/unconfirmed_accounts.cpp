@@ -0,0 +1,156 @@
+#include <nano/secure/unconfirmed_accounts.hpp>
+
+nano::unconfirmed_accounts::unconfirmed_accounts (size_t max_size_a) :
+	max_size{ max_size_a }
+{
+}
+
+void nano::unconfirmed_accounts::put (nano::account const & account, uint64_t block_count)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	auto [it, inserted] = accounts.try_emplace (account, block_count);
+	if (!inserted)
+	{
+		it->second = block_count;
+	}
+	else
+	{
+		check_overflow ();
+	}
+}
+
+void nano::unconfirmed_accounts::put_if_absent (nano::account const & account, uint64_t block_count)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	// An existing entry was recorded by the ledger, which is never older than what a scan read
+	auto [it, inserted] = accounts.try_emplace (account, block_count);
+	if (inserted)
+	{
+		check_overflow ();
+	}
+}
+
+void nano::unconfirmed_accounts::check_overflow ()
+{
+	debug_assert (!mutex.try_lock ());
+	if (accounts.size () > max_size)
+	{
+		// Too many unconfirmed accounts to track (e.g. during initial bootstrap), fall back to scanning until it can be rebuilt
+		accounts.clear ();
+		complete_m = false;
+		++overflows;
+	}
+}
+
+void nano::unconfirmed_accounts::erase (nano::account const & account, uint64_t height)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	auto it = accounts.find (account);
+	if (it != accounts.end () && it->second <= height)
+	{
+		accounts.erase (it);
+	}
+}
+
+std::deque<std::pair<nano::account, uint64_t>> nano::unconfirmed_accounts::next (nano::account const & start, size_t count) const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	std::deque<std::pair<nano::account, uint64_t>> result;
+	for (auto it = accounts.lower_bound (start), end = accounts.end (); it != end && result.size () < count; ++it)
+	{
+		result.emplace_back (*it);
+	}
+	return result;
+}
+
+bool nano::unconfirmed_accounts::complete () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return complete_m;
+}
+
+uint64_t nano::unconfirmed_accounts::scan_begin () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return overflows;
+}
+
+void nano::unconfirmed_accounts::scan_end (uint64_t token)
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	if (token == overflows)
+	{
+		complete_m = true;
+	}
+}
+
+void nano::unconfirmed_accounts::clear ()
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	accounts.clear ();
+	complete_m = false;
+}
+
+size_t nano::unconfirmed_accounts::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return accounts.size ();
+}
+
+bool nano::unconfirmed_accounts::exists (nano::account const & account) const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return accounts.contains (account);
+}
+
+void nano::unconfirmed_accounts::serialize (nano::stream & stream) const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	// An incomplete index is not worth saving, it has to be rebuilt by a full scan either way
+	nano::write (stream, static_cast<uint8_t> (complete_m));
+	nano::write (stream, static_cast<uint64_t> (complete_m ? accounts.size () : 0));
+	if (complete_m)
+	{
+		for (auto const & [account, block_count] : accounts)
+		{
+			nano::write (stream, account);
+			nano::write (stream, block_count);
+		}
+	}
+}
+
+bool nano::unconfirmed_accounts::deserialize (nano::stream & stream)
+{
+	try
+	{
+		uint8_t complete_l;
+		uint64_t count;
+		nano::read (stream, complete_l);
+		nano::read (stream, count);
+		std::map<nano::account, uint64_t> accounts_l;
+		for (uint64_t i = 0; i < count; ++i)
+		{
+			nano::account account;
+			uint64_t block_count;
+			nano::read (stream, account);
+			nano::read (stream, block_count);
+			accounts_l.emplace_hint (accounts_l.end (), account, block_count);
+		}
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		accounts = std::move (accounts_l);
+		complete_m = complete_l != 0;
+	}
+	catch (std::runtime_error const &)
+	{
+		return true;
+	}
+	return false;
+}
+
+nano::container_info nano::unconfirmed_accounts::container_info () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	nano::container_info info;
+	info.put ("accounts", accounts.size (), sizeof (decltype (accounts)::value_type));
+	return info;
+}
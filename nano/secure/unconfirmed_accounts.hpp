@@ -0,0 +1,65 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/stream.hpp>
+#include <nano/lib/utility.hpp>
+
+#include <deque>
+#include <map>
+#include <utility>
+
+namespace nano
+{
+/**
+ * Index of accounts which may have blocks above their confirmation height, ordered by account
+ * Kept up to date by the ledger as blocks are processed, rolled back and cemented. Entries are a superset of the unconfirmed accounts,
+ * accounts that became confirmed without the ledger noticing are removed by whoever next reads them from the ledger
+ * The index is only trusted once `complete`, either after being loaded from the ledger cache snapshot or after one full account scan
+ * was finished without the index overflowing in the meantime
+ */
+class unconfirmed_accounts final
+{
+public:
+	explicit unconfirmed_accounts (size_t max_size = 1024 * 1024);
+
+	/** Records that the chain of `account` changed and is now `block_count` blocks long */
+	void put (nano::account const &, uint64_t block_count);
+	/** Records the account unless it is already indexed, for scans whose `block_count` may have been read before a newer `put` by the ledger */
+	void put_if_absent (nano::account const &, uint64_t block_count);
+	/** Removes the account unless its chain grew beyond `height` since, called once everything up to `height` is known to be cemented */
+	void erase (nano::account const &, uint64_t height);
+	/** Returns up to `count` accounts starting at `start`, along with the chain length they were last recorded with */
+	std::deque<std::pair<nano::account, uint64_t>> next (nano::account const & start, size_t count) const;
+
+	/** Whether the index holds every unconfirmed account */
+	bool complete () const;
+	/** Starts a full account scan rebuilding the index, the returned token is passed to `scan_end` */
+	uint64_t scan_begin () const;
+	/** Marks the index complete if it did not overflow since the scan began */
+	void scan_end (uint64_t token);
+
+	/** Drops every entry and marks the index incomplete */
+	void clear ();
+
+	size_t size () const;
+	bool exists (nano::account const &) const;
+
+	void serialize (nano::stream &) const;
+	/** Returns true on error, the index is left incomplete */
+	bool deserialize (nano::stream &);
+
+	nano::container_info container_info () const;
+
+private:
+	/** Drops the whole index if it grew past `max_size` */
+	void check_overflow ();
+
+	size_t const max_size;
+	std::map<nano::account, uint64_t> accounts;
+	bool complete_m{ false };
+	/** Incremented every time the index is dropped for growing past `max_size` */
+	uint64_t overflows{ 0 };
+	mutable nano::mutex mutex;
+};
+}
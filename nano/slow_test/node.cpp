@@ -321,10 +321,8 @@ TEST (node, fork_storm)
 			}
 			else
 			{
-				nano::unique_lock<nano::mutex> lock{ node_a->active.mutex };
-				auto election = node_a->active.roots.begin ()->election;
-				lock.unlock ();
-				if (election->votes ().size () == 1)
+				auto elections = node_a->active.list_active (1);
+				if (!elections.empty () && elections.front ()->votes ().size () == 1)
 				{
 					++single;
 				}
@@ -1803,10 +1801,7 @@ TEST (node, mass_block_new)
 			std::this_thread::sleep_for (std::chrono::milliseconds{ 100 });
 		}
 		// Clear all active
-		{
-			nano::lock_guard<nano::mutex> guard{ node.active.mutex };
-			node.active.roots.clear ();
-		}
+		node.active.clear ();
 	};
 
 	nano::keypair key;
@@ -2168,13 +2163,11 @@ TEST (system, block_sequence)
 			for (auto i : system.nodes)
 			{
 				message += boost::str (boost::format ("N:%1% b:%2% c:%3% a:%4% s:%5% p:%6%\n") % std::to_string (i->network.port) % std::to_string (i->ledger.block_count ()) % std::to_string (i->ledger.cemented_count ()) % std::to_string (i->active.size ()) % std::to_string (i->scheduler.priority.size ()) % std::to_string (i->network.size ()));
-				nano::lock_guard<nano::mutex> lock{ i->active.mutex };
-				for (auto const & j : i->active.roots)
+				for (auto const & election : i->active.list_active ())
 				{
-					auto election = j.election;
 					if (election->confirmation_request_count > 10)
 					{
-						message += boost::str (boost::format ("\t r:%1% i:%2%\n") % j.root.to_string () % std::to_string (election->confirmation_request_count));
+						message += boost::str (boost::format ("\t r:%1% i:%2%\n") % election->qualified_root.to_string () % std::to_string (election->confirmation_request_count));
 						for (auto const & k : election->votes ())
 						{
 							message += boost::str (boost::format ("\t\t r:%1% t:%2%\n") % k.first.to_account () % std::to_string (k.second.timestamp));
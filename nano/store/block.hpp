@@ -7,6 +7,7 @@
 
 #include <functional>
 #include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -30,6 +31,11 @@ public:
 	virtual void put (store::write_transaction const &, nano::block_hash const &, nano::block const &) = 0;
 	virtual void raw_put (store::write_transaction const &, std::vector<uint8_t> const &, nano::block_hash const &) = 0;
 	virtual std::optional<nano::block_hash> successor (store::transaction const &, nano::block_hash const &) const = 0;
+	/**
+	 * Appends the block in its wire serialization to `block` and reads its successor, straight from the stored bytes without deserializing it
+	 * Returns true if the block was not found
+	 */
+	virtual bool get_serialized (store::transaction const &, nano::block_hash const &, std::vector<uint8_t> & block, nano::block_hash & successor) const = 0;
 	virtual void successor_clear (store::write_transaction const &, nano::block_hash const &) = 0;
 	virtual std::shared_ptr<nano::block> get (store::transaction const &, nano::block_hash const &) const = 0;
 	virtual std::shared_ptr<nano::block> random (store::transaction const &) = 0;
@@ -30,6 +30,7 @@ namespace store
 	class rep_weight;
 }
 class ledger_cache;
+class stats;
 
 namespace store
 {
@@ -59,6 +60,8 @@ namespace store
 		virtual ~component () = default;
 		void initialize (write_transaction const & transaction_a, nano::ledger_cache & ledger_cache_a, nano::ledger_constants & constants);
 		virtual uint64_t count (store::transaction const & transaction_a, tables table_a) const = 0;
+		/** Sequence number of the committed state visible to the transaction, it advances with every committed write */
+		virtual uint64_t sequence (store::transaction const & transaction_a) const = 0;
 		virtual int drop (write_transaction const & transaction_a, tables table_a) = 0;
 		virtual bool not_found (int status) const = 0;
 		virtual bool success (int status) const = 0;
@@ -92,9 +95,14 @@ namespace store
 		/** Not applicable to all sub-classes */
 		virtual void serialize_mdb_tracker (boost::property_tree::ptree &, std::chrono::milliseconds, std::chrono::milliseconds){};
 		virtual void serialize_memory_stats (boost::property_tree::ptree &) = 0;
+		/** Adds backend counters accumulated since the previous call to node stats, not applicable to all sub-classes */
+		virtual void export_stats (nano::stats &){};
 
 		virtual bool init_error () const = 0;
 
+		/** Blocks until every write committed before the call is durable on disk, returns true if syncing failed */
+		virtual bool flush () = 0;
+
 		/** Start read-write transaction */
 		virtual write_transaction tx_begin_write () = 0;
 
@@ -2,7 +2,9 @@
 
 #include <nano/store/iterator_impl.hpp>
 
+#include <cstdint>
 #include <memory>
+#include <span>
 
 namespace nano::store
 {
@@ -19,40 +21,69 @@ public:
 	iterator (std::unique_ptr<iterator_impl<T, U>> impl_a) :
 		impl (std::move (impl_a))
 	{
-		impl->fill (current);
 	}
 	iterator (iterator<T, U> && other_a) :
 		current (std::move (other_a.current)),
+		filled (other_a.filled),
 		impl (std::move (other_a.impl))
 	{
 	}
 	iterator<T, U> & operator++ ()
 	{
 		++*impl;
-		impl->fill (current);
+		filled = false;
 		return *this;
 	}
 	iterator<T, U> & operator-- ()
 	{
 		--*impl;
-		impl->fill (current);
+		filled = false;
 		return *this;
 	}
 	iterator<T, U> & operator= (iterator<T, U> && other_a) noexcept
 	{
 		impl = std::move (other_a.impl);
 		current = std::move (other_a.current);
+		filled = other_a.filled;
 		return *this;
 	}
 	iterator<T, U> & operator= (iterator<T, U> const &) = delete;
 	std::pair<T, U> * operator->()
 	{
+		fill ();
 		return &current;
 	}
 	std::pair<T, U> const & operator* () const
 	{
+		fill ();
 		return current;
 	}
+	/**
+	 * Raw bytes of the current key and value, read in place without deserializing
+	 * Only valid until the iterator moves or the transaction ends
+	 */
+	std::span<uint8_t const> key_bytes () const
+	{
+		debug_assert (impl != nullptr);
+		return impl->key_bytes ();
+	}
+	std::span<uint8_t const> value_bytes () const
+	{
+		debug_assert (impl != nullptr);
+		return impl->value_bytes ();
+	}
+	/** Typed view over the current value, see value_view.hpp */
+	template <typename View>
+	View value_view () const
+	{
+		return View{ value_bytes () };
+	}
+	/** Typed view over the current key, see value_view.hpp */
+	template <typename View>
+	View key_view () const
+	{
+		return View{ key_bytes () };
+	}
 	bool operator== (iterator<T, U> const & other_a) const
 	{
 		return (impl == nullptr && other_a.impl == nullptr) || (impl != nullptr && *impl == other_a.impl.get ()) || (other_a.impl != nullptr && *other_a.impl == impl.get ());
@@ -63,7 +94,18 @@ public:
 	}
 
 private:
-	std::pair<T, U> current;
+	/** Keys and values are only deserialized when accessed, scans using the raw accessors skip it entirely */
+	void fill () const
+	{
+		if (!filled && impl != nullptr)
+		{
+			impl->fill (current);
+			filled = true;
+		}
+	}
+
+	mutable std::pair<T, U> current;
+	mutable bool filled{ false };
 	std::unique_ptr<iterator_impl<T, U>> impl;
 };
 } // namespace nano::store
@@ -3,6 +3,8 @@
 #include <nano/lib/utility.hpp>
 #include <nano/store/transaction.hpp>
 
+#include <cstdint>
+#include <span>
 #include <utility>
 
 namespace nano::store
@@ -26,6 +28,9 @@ public:
 	virtual bool operator== (iterator_impl<T, U> const & other_a) const = 0;
 	virtual bool is_end_sentinal () const = 0;
 	virtual void fill (std::pair<T, U> &) const = 0;
+	/** Raw bytes of the current key and value, only valid until the iterator moves or the transaction ends */
+	virtual std::span<uint8_t const> key_bytes () const = 0;
+	virtual std::span<uint8_t const> value_bytes () const = 0;
 	iterator_impl<T, U> & operator= (iterator_impl<T, U> const &) = delete;
 	bool operator== (iterator_impl<T, U> const * other_a) const
 	{
@@ -74,6 +74,23 @@ std::optional<nano::block_hash> nano::store::lmdb::block::successor (store::tran
 	return result;
 }
 
+bool nano::store::lmdb::block::get_serialized (store::transaction const & transaction_a, nano::block_hash const & hash_a, std::vector<uint8_t> & block_a, nano::block_hash & successor_a) const
+{
+	nano::store::lmdb::db_val value;
+	block_raw_get (transaction_a, hash_a, value);
+	if (value.size () == 0)
+	{
+		return true;
+	}
+	auto const type = block_type_from_raw (value.data ());
+	auto const offset = block_successor_offset (transaction_a, value.size (), type);
+	auto const data = reinterpret_cast<uint8_t const *> (value.data ());
+	// Stored entries are the serialized block followed by its sideband, which starts with the successor
+	block_a.insert (block_a.end (), data, data + offset);
+	std::copy (data + offset, data + offset + successor_a.bytes.size (), successor_a.bytes.begin ());
+	return false;
+}
+
 void nano::store::lmdb::block::successor_clear (store::write_transaction const & transaction, nano::block_hash const & hash)
 {
 	nano::store::lmdb::db_val value;
@@ -0,0 +1,115 @@
+#include <nano/lib/thread_roles.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/store/lmdb/group_commit.hpp>
+
+nano::store::lmdb::group_commit::group_commit (MDB_env * environment_a, std::chrono::milliseconds interval_a, uint64_t max_pending_a) :
+	environment{ environment_a },
+	interval{ interval_a },
+	max_pending{ max_pending_a }
+{
+	debug_assert (environment != nullptr);
+}
+
+nano::store::lmdb::group_commit::~group_commit ()
+{
+	// Thread must be stopped before destruction
+	debug_assert (!thread.joinable ());
+}
+
+void nano::store::lmdb::group_commit::start ()
+{
+	debug_assert (!thread.joinable ());
+
+	thread = std::thread ([this] () {
+		nano::thread_role::set (nano::thread_role::name::lmdb_sync);
+		run ();
+	});
+}
+
+void nano::store::lmdb::group_commit::stop ()
+{
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		stopped = true;
+	}
+	condition.notify_all ();
+	if (thread.joinable ())
+	{
+		thread.join ();
+	}
+}
+
+void nano::store::lmdb::group_commit::committed ()
+{
+	bool notify = false;
+	{
+		nano::lock_guard<nano::mutex> guard{ mutex };
+		++commits;
+		notify = max_pending > 0 && commits - attempted >= max_pending;
+	}
+	if (notify)
+	{
+		condition.notify_all ();
+	}
+}
+
+int nano::store::lmdb::group_commit::wait ()
+{
+	nano::unique_lock<nano::mutex> lock{ mutex };
+	auto const target = commits;
+	if (synced >= target)
+	{
+		return MDB_SUCCESS;
+	}
+	// A sync already running may have started before the last commit, only one started after this call covers it
+	auto const after = attempts + (syncing ? 1 : 0);
+	requested = true;
+	condition.notify_all ();
+	// After stopping, the environment gets synced when closed
+	condition.wait (lock, [this, target, after] () { return synced >= target || attempts > after || stopped; });
+	return synced >= target || stopped ? MDB_SUCCESS : status;
+}
+
+uint64_t nano::store::lmdb::group_commit::take_failures ()
+{
+	return failures.exchange (0);
+}
+
+bool nano::store::lmdb::group_commit::sync_needed () const
+{
+	debug_assert (!mutex.try_lock ());
+	return requested || (max_pending > 0 && commits - attempted >= max_pending);
+}
+
+void nano::store::lmdb::group_commit::run ()
+{
+	nano::unique_lock<nano::mutex> lock{ mutex };
+	while (!stopped)
+	{
+		condition.wait_for (lock, interval, [this] () { return stopped || sync_needed (); });
+		requested = false;
+
+		if (commits > synced)
+		{
+			auto const target = commits;
+			syncing = true;
+			lock.unlock ();
+			// Commits made while syncing are left for the next round, a failed sync is retried with them on the next interval
+			auto const result = mdb_env_sync (environment, 1);
+			lock.lock ();
+			syncing = false;
+			++attempts;
+			attempted = target;
+			status = result;
+			if (result == MDB_SUCCESS)
+			{
+				synced = target;
+			}
+			else
+			{
+				++failures;
+			}
+			condition.notify_all ();
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <nano/lib/locks.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include <lmdb/libraries/liblmdb/lmdb.h>
+
+namespace nano::store::lmdb
+{
+/**
+ * Coalesces fsyncs of an environment opened with MDB_NOSYNC
+ * Commits only get counted, a dedicated thread syncs the environment once the interval elapses, once enough commits are pending
+ * or as soon as a caller waits for durability. A single sync covers every commit made before it started
+ */
+class group_commit final
+{
+public:
+	group_commit (MDB_env *, std::chrono::milliseconds interval, uint64_t max_pending);
+	~group_commit ();
+
+	void start ();
+	void stop ();
+
+	/** Called after every successful write transaction commit */
+	void committed ();
+	/** Blocks until a sync covering every commit made before the call was attempted, returns its LMDB status */
+	int wait ();
+	/** Number of failed syncs since the previous call */
+	uint64_t take_failures ();
+
+private:
+	void run ();
+	bool sync_needed () const;
+
+private:
+	MDB_env * const environment;
+	std::chrono::milliseconds const interval;
+	uint64_t const max_pending;
+
+	// Number of commits counted so far, synced up to and covered by the last sync attempt
+	uint64_t commits{ 0 };
+	uint64_t synced{ 0 };
+	uint64_t attempted{ 0 };
+	// Number of finished sync attempts and the result of the last one
+	uint64_t attempts{ 0 };
+	int status{ MDB_SUCCESS };
+	bool syncing{ false };
+	bool requested{ false }; // A caller is waiting for durability
+	std::atomic<uint64_t> failures{ 0 };
+
+	bool stopped{ false };
+	nano::condition_variable condition;
+	mutable nano::mutex mutex;
+	std::thread thread;
+};
+}
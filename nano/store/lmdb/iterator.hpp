@@ -144,6 +144,14 @@ public:
 			value_a.second = U ();
 		}
 	}
+	std::span<uint8_t const> key_bytes () const override
+	{
+		return { static_cast<uint8_t const *> (current.first.data ()), current.first.size () };
+	}
+	std::span<uint8_t const> value_bytes () const override
+	{
+		return { static_cast<uint8_t const *> (current.second.data ()), current.second.size () };
+	}
 	void clear ()
 	{
 		current.first = store::db_val<MDB_val> ();
@@ -261,6 +269,14 @@ public:
 			value_a.second = U ();
 		}
 	}
+	std::span<uint8_t const> key_bytes () const override
+	{
+		return least_iterator ().key_bytes ();
+	}
+	std::span<uint8_t const> value_bytes () const override
+	{
+		return least_iterator ().value_bytes ();
+	}
 	merge_iterator<T, U> & operator= (merge_iterator<T, U> &&) = default;
 	merge_iterator<T, U> & operator= (merge_iterator<T, U> const &) = delete;
 
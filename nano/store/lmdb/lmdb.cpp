@@ -1,4 +1,5 @@
 #include <nano/lib/numbers.hpp>
+#include <nano/lib/stats.hpp>
 #include <nano/lib/stream.hpp>
 #include <nano/lib/utility.hpp>
 #include <nano/secure/ledger.hpp>
@@ -385,6 +386,13 @@ uint64_t nano::store::lmdb::component::count (store::transaction const & transac
 	return count (transaction_a, table_to_dbi (table_a));
 }
 
+uint64_t nano::store::lmdb::component::sequence (store::transaction const & transaction_a) const
+{
+	auto const id = mdb_txn_id (env.tx (transaction_a));
+	// Write transactions carry the id of the state they are going to commit
+	return dynamic_cast<store::write_transaction const *> (&transaction_a) != nullptr ? id - 1 : id;
+}
+
 uint64_t nano::store::lmdb::component::count (store::transaction const & transaction_a, MDB_dbi db_a) const
 {
 	MDB_stat stats;
@@ -503,6 +511,21 @@ bool nano::store::lmdb::component::init_error () const
 	return error;
 }
 
+bool nano::store::lmdb::component::flush ()
+{
+	auto status = env.flush ();
+	if (status != MDB_SUCCESS)
+	{
+		logger.error (nano::log::type::lmdb, "Failed to sync ledger database: {}", mdb_strerror (status));
+	}
+	return status != MDB_SUCCESS;
+}
+
+void nano::store::lmdb::component::export_stats (nano::stats & stats)
+{
+	stats.add (nano::stat::type::lmdb, nano::stat::detail::sync_failed, env.take_sync_failures ());
+}
+
 nano::store::lmdb::component::upgrade_counters::upgrade_counters (uint64_t count_before_v0, uint64_t count_before_v1) :
 	before_v0 (count_before_v0),
 	before_v1 (count_before_v1)
@@ -106,6 +106,8 @@ public:
 	}
 
 	bool init_error () const override;
+	bool flush () override;
+	void export_stats (nano::stats &) override;
 
 	uint64_t count (store::transaction const &, MDB_dbi) const;
 	std::string error_string (int status) const override;
@@ -139,6 +141,7 @@ private:
 	bool txn_tracking_enabled;
 
 	uint64_t count (store::transaction const & transaction_a, tables table_a) const override;
+	uint64_t sequence (store::transaction const & transaction_a) const override;
 
 	bool vacuum_after_upgrade (std::filesystem::path const & path_a, nano::lmdb_config const & lmdb_config_a);
 
@@ -49,6 +49,11 @@ void nano::store::lmdb::env::init (bool & error_a, std::filesystem::path const &
 			{
 				environment_flags |= MDB_NOSYNC | MDB_WRITEMAP | MDB_MAPASYNC;
 			}
+			else if (options_a.config.sync == nano::lmdb_config::sync_strategy::group_commit)
+			{
+				// Same as nosync_unsafe between the syncs done by the group commit thread
+				environment_flags |= MDB_NOSYNC;
+			}
 
 			if (!memory_intensive_instrumentation () && options_a.use_no_mem_init)
 			{
@@ -62,6 +67,12 @@ void nano::store::lmdb::env::init (bool & error_a, std::filesystem::path const &
 			}
 			release_assert (status4 == 0);
 			error_a = status4 != 0;
+			sync = options_a.config.sync;
+			if (sync == nano::lmdb_config::sync_strategy::group_commit)
+			{
+				flusher = std::make_unique<nano::store::lmdb::group_commit> (environment, options_a.config.sync_interval, options_a.config.sync_max_pending);
+				flusher->start ();
+			}
 		}
 		else
 		{
@@ -78,6 +89,10 @@ void nano::store::lmdb::env::init (bool & error_a, std::filesystem::path const &
 
 nano::store::lmdb::env::~env ()
 {
+	if (flusher)
+	{
+		flusher->stop ();
+	}
 	if (environment != nullptr)
 	{
 		// Make sure the commits are flushed. This is a no-op unless MDB_NOSYNC is used.
@@ -101,6 +116,29 @@ nano::store::write_transaction nano::store::lmdb::env::tx_begin_write (store::lm
 	return store::write_transaction{ std::make_unique<nano::store::lmdb::write_transaction_impl> (*this, mdb_txn_callbacks) };
 }
 
+int nano::store::lmdb::env::flush () const
+{
+	if (flusher)
+	{
+		return flusher->wait ();
+	}
+	auto status = MDB_SUCCESS;
+	if (sync != nano::lmdb_config::sync_strategy::always)
+	{
+		status = mdb_env_sync (environment, 1);
+		if (status != MDB_SUCCESS)
+		{
+			++sync_failures;
+		}
+	}
+	return status;
+}
+
+uint64_t nano::store::lmdb::env::take_sync_failures () const
+{
+	return sync_failures.exchange (0) + (flusher ? flusher->take_failures () : 0);
+}
+
 MDB_txn * nano::store::lmdb::env::tx (store::transaction const & transaction_a) const
 {
 	debug_assert (transaction_a.store_id () == store_id);
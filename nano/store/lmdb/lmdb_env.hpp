@@ -3,8 +3,12 @@
 #include <nano/lib/id_dispenser.hpp>
 #include <nano/lib/lmdbconfig.hpp>
 #include <nano/store/component.hpp>
+#include <nano/store/lmdb/group_commit.hpp>
 #include <nano/store/lmdb/transaction_impl.hpp>
 
+#include <atomic>
+#include <memory>
+
 namespace nano::store::lmdb
 {
 /**
@@ -62,7 +66,15 @@ public:
 	store::read_transaction tx_begin_read (txn_callbacks callbacks = txn_callbacks{}) const;
 	store::write_transaction tx_begin_write (txn_callbacks callbacks = txn_callbacks{}) const;
 	MDB_txn * tx (store::transaction const & transaction_a) const;
+	/** Blocks until every commit made before the call is durable, returns the LMDB status of the sync */
+	int flush () const;
+	/** Number of failed syncs since the previous call */
+	uint64_t take_sync_failures () const;
 	MDB_env * environment;
+	nano::lmdb_config::sync_strategy sync{ nano::lmdb_config::sync_strategy::always };
+	/** Only set when using the group_commit sync strategy */
+	std::unique_ptr<nano::store::lmdb::group_commit> flusher;
+	mutable std::atomic<uint64_t> sync_failures{ 0 };
 	nano::id_t const store_id{ nano::next_id () };
 };
 } // namespace nano::store::lmdb
@@ -92,6 +92,10 @@ void nano::store::lmdb::write_transaction_impl::commit ()
 		{
 			release_assert (false && "Unable to write to the LMDB database", mdb_strerror (status));
 		}
+		if (env.flusher)
+		{
+			env.flusher->committed ();
+		}
 		txn_callbacks.txn_end (this);
 		active = false;
 	}
@@ -41,12 +41,15 @@ public:
 		{
 			auto read_options = snapshot_options (transaction_a);
 			read_options.fill_cache = false;
+			// Tables may be configured with a prefix extractor, iteration must still visit keys across prefixes
+			read_options.auto_prefix_mode = true;
 			cursor.reset (db->NewIterator (read_options, handle_a));
 		}
 		else
 		{
 			::rocksdb::ReadOptions ropts;
 			ropts.fill_cache = false;
+			ropts.auto_prefix_mode = true;
 			cursor.reset (tx (transaction_a)->GetIterator (ropts, handle_a));
 		}
 
@@ -181,6 +184,14 @@ public:
 			}
 		}
 	}
+	std::span<uint8_t const> key_bytes () const override
+	{
+		return { static_cast<uint8_t const *> (current.first.data ()), current.first.size () };
+	}
+	std::span<uint8_t const> value_bytes () const override
+	{
+		return { static_cast<uint8_t const *> (current.second.data ()), current.second.size () };
+	}
 	void clear ()
 	{
 		current.first = nano::store::rocksdb::db_val{};
@@ -1,5 +1,6 @@
 #include <nano/lib/blocks.hpp>
 #include <nano/lib/rocksdbconfig.hpp>
+#include <nano/lib/stats.hpp>
 #include <nano/store/rocksdb/iterator.hpp>
 #include <nano/store/rocksdb/rocksdb.hpp>
 #include <nano/store/rocksdb/transaction_impl.hpp>
@@ -9,7 +10,10 @@
 #include <boost/polymorphic_cast.hpp>
 #include <boost/property_tree/ptree.hpp>
 
+#include <rocksdb/cache.h>
 #include <rocksdb/merge_operator.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/perf_level.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/slice_transform.h>
 #include <rocksdb/utilities/backup_engine.h>
@@ -33,6 +37,23 @@ public:
 private:
 	std::function<void (rocksdb::FlushJobInfo const &)> flush_completed_cb;
 };
+
+rocksdb::CompressionType to_compression_type (std::string const & name)
+{
+	if (name == "snappy")
+	{
+		return rocksdb::kSnappyCompression;
+	}
+	if (name == "lz4")
+	{
+		return rocksdb::kLZ4Compression;
+	}
+	if (name == "zstd")
+	{
+		return rocksdb::kZSTD;
+	}
+	return rocksdb::kNoCompression;
+}
 }
 
 nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesystem::path const & path_a, nano::ledger_constants & constants, nano::rocksdb_config const & rocksdb_config_a, bool open_read_only_a) :
@@ -64,6 +85,8 @@ nano::store::rocksdb::component::component (nano::logger & logger_a, std::filesy
 	constants{ constants },
 	rocksdb_config{ rocksdb_config_a },
 	max_block_write_batch_num_m{ nano::narrow_cast<unsigned> ((rocksdb_config_a.write_cache * 1024 * 1024) / (2 * (sizeof (nano::block_type) + nano::state_block::size + nano::block_sideband::size (nano::block_type::state)))) },
+	block_cache{ create_block_cache () },
+	statistics{ rocksdb_config_a.statistics ? ::rocksdb::CreateDBStatistics () : nullptr },
 	cf_name_table_map{ create_cf_name_table_map () }
 {
 	boost::system::error_code error_mkdir, error_chmod;
@@ -380,14 +403,75 @@ rocksdb::ColumnFamilyOptions nano::store::rocksdb::component::get_cf_options (st
 	::rocksdb::ColumnFamilyOptions cf_options;
 	if (cf_name_a != ::rocksdb::kDefaultColumnFamilyName)
 	{
-		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_table_options ()));
+		auto const table_config = get_table_config (cf_name_a);
+		std::shared_ptr<::rocksdb::TableFactory> table_factory (::rocksdb::NewBlockBasedTableFactory (get_table_options (table_config)));
 		cf_options.table_factory = table_factory;
 		// Size of each memtable (write buffer for this column family)
 		cf_options.write_buffer_size = rocksdb_config.write_cache * 1024 * 1024;
+
+		if (table_config)
+		{
+			// Upper levels hold recently written data which is rewritten frequently by compactions, only compress the lower levels
+			auto const compression = to_compression_type (table_config->compression);
+			if (compression != ::rocksdb::kNoCompression)
+			{
+				cf_options.compression_per_level.resize (cf_options.num_levels);
+				for (int level = 0; level < cf_options.num_levels; ++level)
+				{
+					cf_options.compression_per_level[level] = level < static_cast<int> (table_config->compression_start_level) ? ::rocksdb::kNoCompression : compression;
+				}
+			}
+
+			// Prefix filters allow skipping SST files when seeking to keys sharing a prefix (e.g. pending entries of a single account)
+			if (table_config->prefix_length > 0)
+			{
+				cf_options.prefix_extractor.reset (::rocksdb::NewFixedPrefixTransform (table_config->prefix_length));
+			}
+		}
 	}
 	return cf_options;
 }
 
+nano::rocksdb_table_config const * nano::store::rocksdb::component::get_table_config (std::string const & cf_name_a) const
+{
+	if (cf_name_a == "blocks")
+	{
+		return &rocksdb_config.blocks;
+	}
+	if (cf_name_a == "accounts")
+	{
+		return &rocksdb_config.accounts;
+	}
+	if (cf_name_a == "pending")
+	{
+		return &rocksdb_config.pending;
+	}
+	if (cf_name_a == "confirmation_height")
+	{
+		return &rocksdb_config.confirmation_height;
+	}
+	if (cf_name_a == "rep_weights")
+	{
+		return &rocksdb_config.rep_weights;
+	}
+	return nullptr;
+}
+
+std::shared_ptr<rocksdb::Cache> nano::store::rocksdb::component::create_block_cache () const
+{
+	if (rocksdb_config.block_cache == 0)
+	{
+		return nullptr;
+	}
+	std::size_t const capacity = rocksdb_config.block_cache * 1024 * 1024;
+	if (rocksdb_config.block_cache_type == "hyper_clock")
+	{
+		// Estimated entry charge matches the default data block size
+		return ::rocksdb::HyperClockCacheOptions (capacity, 4 * 1024).MakeSharedCache ();
+	}
+	return ::rocksdb::NewLRUCache (capacity);
+}
+
 std::vector<rocksdb::ColumnFamilyDescriptor> nano::store::rocksdb::component::create_column_families ()
 {
 	std::vector<::rocksdb::ColumnFamilyDescriptor> column_families;
@@ -548,6 +632,17 @@ rocksdb::Transaction * nano::store::rocksdb::component::tx (store::transaction c
 
 int nano::store::rocksdb::component::get (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val & value_a) const
 {
+	// Perf level and context are thread local, the level is set once per thread and counters accumulate over many lookups before being collected
+	thread_local bool perf_enabled{ false };
+	thread_local unsigned perf_lookups{ 0 };
+	bool const track_perf = statistics != nullptr;
+	if (track_perf && !perf_enabled)
+	{
+		::rocksdb::SetPerfLevel (::rocksdb::PerfLevel::kEnableCount);
+		::rocksdb::get_perf_context ()->Reset ();
+		perf_enabled = true;
+	}
+
 	::rocksdb::ReadOptions options;
 	::rocksdb::PinnableSlice slice;
 	auto handle = table_to_column_family (table_a);
@@ -561,6 +656,17 @@ int nano::store::rocksdb::component::get (store::transaction const & transaction
 		status = tx (transaction_a)->Get (options, handle, key_a, &slice);
 	}
 
+	if (track_perf && ++perf_lookups % perf_collect_interval == 0)
+	{
+		auto & context = *::rocksdb::get_perf_context ();
+		perf.memtable_get += context.get_from_memtable_count;
+		perf.block_read += context.block_read_count;
+		perf.block_read_bytes += context.block_read_byte;
+		perf.bloom_sst_hit += context.bloom_sst_hit_count;
+		perf.bloom_sst_miss += context.bloom_sst_miss_count;
+		context.Reset ();
+	}
+
 	if (status.ok ())
 	{
 		value_a.buffer = std::make_shared<std::vector<uint8_t>> (slice.size ());
@@ -592,6 +698,16 @@ int nano::store::rocksdb::component::status_code_not_found () const
 	return static_cast<int> (::rocksdb::Status::Code::kNotFound);
 }
 
+uint64_t nano::store::rocksdb::component::sequence (store::transaction const & transaction_a) const
+{
+	if (is_read (transaction_a))
+	{
+		return snapshot_options (transaction_a).snapshot->GetSequenceNumber ();
+	}
+	// Write transactions are started with a snapshot
+	return tx (transaction_a)->GetSnapshot ()->GetSequenceNumber ();
+}
+
 uint64_t nano::store::rocksdb::component::count (store::transaction const & transaction_a, tables table_a) const
 {
 	uint64_t sum = 0;
@@ -691,6 +807,7 @@ int nano::store::rocksdb::component::drop (store::write_transaction const & tran
 int nano::store::rocksdb::component::clear (::rocksdb::ColumnFamilyHandle * column_family)
 {
 	::rocksdb::ReadOptions read_options;
+	read_options.total_order_seek = true;
 	::rocksdb::WriteOptions write_options;
 	::rocksdb::WriteBatch write_batch;
 	std::unique_ptr<::rocksdb::Iterator> it (db->NewIterator (read_options, column_family));
@@ -718,9 +835,11 @@ rocksdb::Options nano::store::rocksdb::component::get_db_options ()
 	// Set max number of threads
 	db_options.IncreaseParallelism (rocksdb_config.io_threads);
 
-	// Not compressing any SST files for compatibility reasons.
+	// Not compressing any SST files for compatibility reasons, compression can be enabled per table
 	db_options.compression = ::rocksdb::kNoCompression;
 
+	db_options.statistics = statistics;
+
 	auto event_listener_l = new event_listener ([this] (::rocksdb::FlushJobInfo const & flush_job_info_a) {
 		this->on_flush (flush_job_info_a);
 	});
@@ -729,7 +848,7 @@ rocksdb::Options nano::store::rocksdb::component::get_db_options ()
 	return db_options;
 }
 
-rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_options () const
+rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_options (nano::rocksdb_table_config const * table_config) const
 {
 	::rocksdb::BlockBasedTableOptions table_options;
 
@@ -741,11 +860,22 @@ rocksdb::BlockBasedTableOptions nano::store::rocksdb::component::get_table_optio
 	// Any existing ledger data in version 4 will not be migrated. New data will be written in version 5.
 	table_options.format_version = 5;
 
-	// Block cache for reads
-	table_options.block_cache = ::rocksdb::NewLRUCache (rocksdb_config.read_cache * 1024 * 1024);
+	// Block cache for reads, either shared by all tables or one per table
+	table_options.block_cache = block_cache ? block_cache : ::rocksdb::NewLRUCache (rocksdb_config.read_cache * 1024 * 1024);
 
-	// Bloom filter to help with point reads. 10bits gives 1% false positive rate.
-	table_options.filter_policy.reset (::rocksdb::NewBloomFilterPolicy (10, false));
+	// Filter to help with point reads. 10bits gives 1% false positive rate.
+	auto const bits_per_key = table_config ? table_config->filter_bits_per_key : 10.0;
+	if (bits_per_key > 0)
+	{
+		if (table_config && table_config->ribbon_filter)
+		{
+			table_options.filter_policy.reset (::rocksdb::NewRibbonFilterPolicy (bits_per_key));
+		}
+		else
+		{
+			table_options.filter_policy.reset (::rocksdb::NewBloomFilterPolicy (bits_per_key, false));
+		}
+	}
 
 	return table_options;
 }
@@ -844,6 +974,18 @@ bool nano::store::rocksdb::component::init_error () const
 	return error;
 }
 
+bool nano::store::rocksdb::component::flush ()
+{
+	// Writes go to the write-ahead log without syncing it. Read-only databases do not support this and have nothing to sync
+	auto status = db->FlushWAL (true);
+	if (!status.ok () && !status.IsNotSupported ())
+	{
+		logger.error (nano::log::type::rocksdb, "Failed to sync write-ahead log: {}", status.ToString ());
+		return true;
+	}
+	return false;
+}
+
 void nano::store::rocksdb::component::serialize_memory_stats (boost::property_tree::ptree & json)
 {
 	uint64_t val;
@@ -891,6 +1033,38 @@ void nano::store::rocksdb::component::serialize_memory_stats (boost::property_tr
 	json.put ("block-cache-usage", val);
 }
 
+void nano::store::rocksdb::component::export_stats (nano::stats & stats)
+{
+	if (!statistics)
+	{
+		return;
+	}
+
+	auto export_ticker = [this, &stats] (nano::stat::detail detail, ::rocksdb::Tickers ticker) {
+		stats.add (nano::stat::type::rocksdb, detail, statistics->getAndResetTickerCount (ticker));
+	};
+	export_ticker (nano::stat::detail::block_cache_hit, ::rocksdb::BLOCK_CACHE_HIT);
+	export_ticker (nano::stat::detail::block_cache_miss, ::rocksdb::BLOCK_CACHE_MISS);
+	export_ticker (nano::stat::detail::bloom_filter_useful, ::rocksdb::BLOOM_FILTER_USEFUL);
+	export_ticker (nano::stat::detail::bloom_filter_full_positive, ::rocksdb::BLOOM_FILTER_FULL_POSITIVE);
+	export_ticker (nano::stat::detail::bloom_filter_prefix_useful, ::rocksdb::BLOOM_FILTER_PREFIX_USEFUL);
+	export_ticker (nano::stat::detail::memtable_hit, ::rocksdb::MEMTABLE_HIT);
+	export_ticker (nano::stat::detail::memtable_miss, ::rocksdb::MEMTABLE_MISS);
+	export_ticker (nano::stat::detail::get_hit_l0, ::rocksdb::GET_HIT_L0);
+	export_ticker (nano::stat::detail::get_hit_l1, ::rocksdb::GET_HIT_L1);
+	export_ticker (nano::stat::detail::get_hit_l2_and_up, ::rocksdb::GET_HIT_L2_AND_UP);
+	export_ticker (nano::stat::detail::bytes_read, ::rocksdb::BYTES_READ);
+	export_ticker (nano::stat::detail::bytes_written, ::rocksdb::BYTES_WRITTEN);
+	export_ticker (nano::stat::detail::compact_read_bytes, ::rocksdb::COMPACT_READ_BYTES);
+	export_ticker (nano::stat::detail::compact_write_bytes, ::rocksdb::COMPACT_WRITE_BYTES);
+
+	stats.add (nano::stat::type::rocksdb_perf, nano::stat::detail::memtable_get, perf.memtable_get.exchange (0));
+	stats.add (nano::stat::type::rocksdb_perf, nano::stat::detail::block_read, perf.block_read.exchange (0));
+	stats.add (nano::stat::type::rocksdb_perf, nano::stat::detail::block_read_bytes, perf.block_read_bytes.exchange (0));
+	stats.add (nano::stat::type::rocksdb_perf, nano::stat::detail::bloom_sst_hit, perf.bloom_sst_hit.exchange (0));
+	stats.add (nano::stat::type::rocksdb_perf, nano::stat::detail::bloom_sst_miss, perf.bloom_sst_miss.exchange (0));
+}
+
 // This is a ratio of the blocks memtable size to keep total write transaction commit size down.
 unsigned nano::store::rocksdb::component::max_block_write_batch_num () const
 {
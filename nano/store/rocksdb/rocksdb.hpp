@@ -21,6 +21,7 @@
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/options.h>
 #include <rocksdb/slice.h>
+#include <rocksdb/statistics.h>
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction_db.h>
 
@@ -28,6 +29,8 @@ namespace nano
 {
 class logging_mt;
 class rocksdb_config;
+class rocksdb_table_config;
+class stats;
 class rocksdb_block_store_tombstone_count_Test;
 }
 
@@ -72,6 +75,7 @@ public:
 	std::string vendor_get () const override;
 
 	uint64_t count (store::transaction const & transaction_a, tables table_a) const override;
+	uint64_t sequence (store::transaction const & transaction_a) const override;
 
 	bool exists (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a) const;
 	int get (store::transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a, nano::store::rocksdb::db_val & value_a) const;
@@ -79,6 +83,7 @@ public:
 	int del (store::write_transaction const & transaction_a, tables table_a, nano::store::rocksdb::db_val const & key_a);
 
 	void serialize_memory_stats (boost::property_tree::ptree &) override;
+	void export_stats (nano::stats &) override;
 
 	bool copy_db (std::filesystem::path const & destination) override;
 	void rebuild_db (store::write_transaction const & transaction_a) override;
@@ -98,6 +103,7 @@ public:
 	}
 
 	bool init_error () const override;
+	bool flush () override;
 
 	std::string error_string (int status) const override;
 
@@ -110,6 +116,21 @@ private:
 	std::vector<std::unique_ptr<::rocksdb::ColumnFamilyHandle>> handles;
 	nano::rocksdb_config rocksdb_config;
 	unsigned const max_block_write_batch_num_m;
+	std::shared_ptr<::rocksdb::Cache> block_cache; // Shared by all tables, null when each table has its own cache
+	std::shared_ptr<::rocksdb::Statistics> statistics; // Null unless enabled in config
+
+	/** Perf context is thread local, each thread adds its counters here every `perf_collect_interval` lookups until exported */
+	static unsigned constexpr perf_collect_interval = 256;
+	class perf_counters
+	{
+	public:
+		std::atomic<uint64_t> memtable_get{ 0 };
+		std::atomic<uint64_t> block_read{ 0 };
+		std::atomic<uint64_t> block_read_bytes{ 0 };
+		std::atomic<uint64_t> bloom_sst_hit{ 0 };
+		std::atomic<uint64_t> bloom_sst_miss{ 0 };
+	};
+	mutable perf_counters perf;
 
 	class tombstone_info
 	{
@@ -152,8 +173,10 @@ private:
 	void upgrade_v23_to_v24 (store::write_transaction &);
 
 	::rocksdb::Options get_db_options ();
-	::rocksdb::BlockBasedTableOptions get_table_options () const;
+	::rocksdb::BlockBasedTableOptions get_table_options (nano::rocksdb_table_config const *) const;
 	::rocksdb::ColumnFamilyOptions get_cf_options (std::string const & cf_name_a) const;
+	nano::rocksdb_table_config const * get_table_config (std::string const & cf_name_a) const;
+	std::shared_ptr<::rocksdb::Cache> create_block_cache () const;
 
 	void on_flush (::rocksdb::FlushJobInfo const &);
 	void flush_table (nano::tables table_a);
@@ -26,3 +26,23 @@ int nano::store::rocksdb::version::get (store::transaction const & transaction_a
 	}
 	return result;
 }
+
+void nano::store::rocksdb::version::cache_put (store::write_transaction const & transaction_a, std::vector<uint8_t> const & snapshot_a)
+{
+	nano::uint256_union cache_key{ 2 };
+	auto status = store.put (transaction_a, tables::meta, cache_key, nano::store::rocksdb::db_val{ snapshot_a.size (), const_cast<uint8_t *> (snapshot_a.data ()) });
+	store.release_assert_success (status);
+}
+
+std::optional<std::vector<uint8_t>> nano::store::rocksdb::version::cache_get (store::transaction const & transaction_a) const
+{
+	nano::uint256_union cache_key{ 2 };
+	nano::store::rocksdb::db_val data;
+	auto status = store.get (transaction_a, tables::meta, cache_key, data);
+	if (store.success (status))
+	{
+		auto const bytes = reinterpret_cast<uint8_t const *> (data.data ());
+		return std::vector<uint8_t> (bytes, bytes + data.size ());
+	}
+	return std::nullopt;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <nano/lib/epoch.hpp>
+#include <nano/lib/numbers.hpp>
+#include <nano/lib/timer.hpp>
+#include <nano/lib/utility.hpp>
+#include <nano/secure/account_info.hpp>
+#include <nano/secure/pending_info.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace nano::store
+{
+/**
+ * Fixed layout accessors reading directly from the bytes of a stored key or value, without deserializing the whole record
+ * Views borrow the database memory and are only valid until the iterator they came from moves or the transaction ends
+ */
+class value_view
+{
+public:
+	explicit value_view (std::span<uint8_t const> bytes_a) :
+		bytes{ bytes_a }
+	{
+	}
+
+	bool empty () const
+	{
+		return bytes.empty ();
+	}
+
+protected:
+	template <typename T>
+	T read (size_t offset) const
+	{
+		debug_assert (offset + sizeof (T) <= bytes.size ());
+		T result;
+		std::memcpy (&result, bytes.data () + offset, sizeof (T));
+		return result;
+	}
+
+	template <typename T>
+	T read_union (size_t offset) const
+	{
+		debug_assert (offset + sizeof (T) <= bytes.size ());
+		T result;
+		std::copy (bytes.data () + offset, bytes.data () + offset + sizeof (T), result.bytes.begin ());
+		return result;
+	}
+
+	std::span<uint8_t const> bytes;
+};
+
+/**
+ * View over an account table value, laid out the same as nano::account_info
+ */
+class account_info_view final : public value_view
+{
+public:
+	using value_view::value_view;
+
+	nano::block_hash head () const
+	{
+		return read_union<nano::block_hash> (head_offset);
+	}
+	nano::account representative () const
+	{
+		return read_union<nano::account> (representative_offset);
+	}
+	nano::block_hash open_block () const
+	{
+		return read_union<nano::block_hash> (open_block_offset);
+	}
+	nano::amount balance () const
+	{
+		return read_union<nano::amount> (balance_offset);
+	}
+	nano::seconds_t modified () const
+	{
+		return read<nano::seconds_t> (modified_offset);
+	}
+	uint64_t block_count () const
+	{
+		return read<uint64_t> (block_count_offset);
+	}
+	nano::epoch epoch () const
+	{
+		return read<nano::epoch> (epoch_offset);
+	}
+	/** Representative is compared in place, so filtering by it does not copy any value */
+	bool representative_equals (nano::account const & account_a) const
+	{
+		debug_assert (representative_offset + sizeof (nano::account) <= bytes.size ());
+		return std::memcmp (bytes.data () + representative_offset, account_a.bytes.data (), sizeof (nano::account)) == 0;
+	}
+
+private:
+	static size_t constexpr head_offset = 0;
+	static size_t constexpr representative_offset = head_offset + sizeof (nano::block_hash);
+	static size_t constexpr open_block_offset = representative_offset + sizeof (nano::account);
+	static size_t constexpr balance_offset = open_block_offset + sizeof (nano::block_hash);
+	static size_t constexpr modified_offset = balance_offset + sizeof (nano::amount);
+	static size_t constexpr block_count_offset = modified_offset + sizeof (nano::seconds_t);
+	static size_t constexpr epoch_offset = block_count_offset + sizeof (uint64_t);
+};
+
+/**
+ * View over a pending table key, laid out the same as nano::pending_key
+ */
+class pending_key_view final : public value_view
+{
+public:
+	using value_view::value_view;
+
+	nano::account account () const
+	{
+		return read_union<nano::account> (0);
+	}
+	nano::block_hash hash () const
+	{
+		return read_union<nano::block_hash> (sizeof (nano::account));
+	}
+};
+
+/**
+ * View over a pending table value, laid out the same as nano::pending_info
+ */
+class pending_info_view final : public value_view
+{
+public:
+	using value_view::value_view;
+
+	nano::account source () const
+	{
+		return read_union<nano::account> (0);
+	}
+	nano::amount amount () const
+	{
+		return read_union<nano::amount> (sizeof (nano::account));
+	}
+	nano::epoch epoch () const
+	{
+		return read<nano::epoch> (sizeof (nano::account) + sizeof (nano::amount));
+	}
+};
+}
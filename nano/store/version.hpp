@@ -4,6 +4,8 @@
 #include <nano/store/component.hpp>
 
 #include <functional>
+#include <optional>
+#include <vector>
 
 namespace nano
 {
@@ -19,5 +21,8 @@ class version
 public:
 	virtual void put (store::write_transaction const &, int) = 0;
 	virtual int get (store::transaction const &) const = 0;
+	/** Opaque ledger cache snapshot, see nano::ledger::save_cache */
+	virtual void cache_put (store::write_transaction const &, std::vector<uint8_t> const &) = 0;
+	virtual std::optional<std::vector<uint8_t>> cache_get (store::transaction const &) const = 0;
 };
 } // namespace nano::store
@@ -69,6 +69,12 @@ bool nano::store::write_queue::contains (writer writer) const
 	return std::find (queue.cbegin (), queue.cend (), writer) != queue.cend ();
 }
 
+std::size_t nano::store::write_queue::size () const
+{
+	nano::lock_guard<nano::mutex> guard{ mutex };
+	return queue.size ();
+}
+
 void nano::store::write_queue::pop ()
 {
 	nano::lock_guard<nano::mutex> guard{ mutex };
@@ -62,6 +62,9 @@ public:
 	/** Returns true if this writer is anywhere in the queue. Currently only used in tests */
 	bool contains (writer writer) const;
 
+	/** Number of writers holding or waiting for write access */
+	std::size_t size () const;
+
 	/** Doesn't actually pop anything until the returned write_guard is out of scope */
 	void pop ();
 